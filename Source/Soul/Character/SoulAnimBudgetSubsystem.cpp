@@ -0,0 +1,183 @@
+#include "SoulAnimBudgetSubsystem.h"
+#include "SoulCombatCharacterBase.h"
+#include "../Common/SoulStats.h"
+
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Animation/AnimInstance.h"
+#include "IAnimationBudgetAllocator.h"
+#include "AnimationBudgetAllocatorParameters.h"
+#include "SkeletalMeshComponentBudgeted.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Anim Budget Significance"), STAT_SoulAnimBudgetSignificance, STATGROUP_Soul);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Anim Budget Never Skip"), STAT_SoulAnimBudgetNeverSkip, STATGROUP_Soul);
+
+static TAutoConsoleVariable<bool> CVarSoulAnimBudget(
+	TEXT("soul.Anim.Budget"),
+	true,
+	TEXT("If true, Soul characters are ticked through the animation budget allocator, which lowers the update rate of\n")
+	TEXT("small or off screen meshes and interpolates between evaluated frames to stay within the per frame budget."),
+	ECVF_Default);
+
+bool USoulAnimBudgetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USoulAnimBudgetSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USoulAnimBudgetSubsystem, STATGROUP_Tickables);
+}
+
+void USoulAnimBudgetSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	IAnimationBudgetAllocator* Allocator = IAnimationBudgetAllocator::Get(&InWorld);
+	if (!Allocator)
+	{
+		return;
+	}
+
+	ApplyParameters(Allocator);
+
+	bBudgetEnabled = CVarSoulAnimBudget.GetValueOnGameThread();
+	Allocator->SetEnabled(bBudgetEnabled);
+}
+
+void USoulAnimBudgetSubsystem::ApplyParameters(IAnimationBudgetAllocator* Allocator) const
+{
+	FAnimationBudgetAllocatorParameters Parameters;
+	Parameters.BudgetInMs = BudgetInMs;
+	Parameters.MaxTickRate = MaxTickRate;
+	Parameters.MaxInterpolatedComponents = MaxInterpolatedComponents;
+
+	Allocator->SetParameters(Parameters);
+}
+
+void USoulAnimBudgetSubsystem::RegisterCharacter(ACharacter* Character)
+{
+	if (!Character || !Cast<USkeletalMeshComponentBudgeted>(Character->GetMesh()))
+	{
+		return;
+	}
+
+	Characters.AddUnique(Character);
+}
+
+void USoulAnimBudgetSubsystem::UnregisterCharacter(ACharacter* Character)
+{
+	Characters.RemoveSwap(Character);
+}
+
+void USoulAnimBudgetSubsystem::RefreshCharacter(ACharacter* Character)
+{
+	if (!bBudgetEnabled || !Character)
+	{
+		return;
+	}
+
+	USkeletalMeshComponentBudgeted* Mesh = Cast<USkeletalMeshComponentBudgeted>(Character->GetMesh());
+	IAnimationBudgetAllocator* Allocator = IAnimationBudgetAllocator::Get(GetWorld());
+	if (!Mesh || !Allocator || !Characters.Contains(Character))
+	{
+		return;
+	}
+
+	Allocator->SetComponentSignificance(Mesh, CalculateSignificance(Mesh, LastViewLocation, LastViewScale), ShouldNeverSkip(Character, Mesh));
+}
+
+void USoulAnimBudgetSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	IAnimationBudgetAllocator* Allocator = IAnimationBudgetAllocator::Get(GetWorld());
+	if (!Allocator)
+	{
+		return;
+	}
+
+	const bool bWantEnabled = CVarSoulAnimBudget.GetValueOnGameThread();
+	if (bWantEnabled != bBudgetEnabled)
+	{
+		bBudgetEnabled = bWantEnabled;
+		Allocator->SetEnabled(bBudgetEnabled);
+	}
+
+	if (!bBudgetEnabled || Characters.IsEmpty())
+	{
+		return;
+	}
+
+	APlayerController* PC = GetWorld()->GetFirstPlayerController();
+	if (!PC)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SoulAnimBudgetSignificance);
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+	const float FOV = PC->PlayerCameraManager ? PC->PlayerCameraManager->GetFOVAngle() : 90;
+	const float ViewScale = 1 / FMath::Tan(FMath::DegreesToRadians(FMath::Max<float>(FOV, 1) * 0.5));
+
+	LastViewLocation = ViewLocation;
+	LastViewScale = ViewScale;
+
+	int32 NumNeverSkip = 0;
+
+	for (int32 Index = Characters.Num() - 1; Index >= 0; --Index)
+	{
+		ACharacter* Character = Characters[Index].Get();
+		USkeletalMeshComponentBudgeted* Mesh = Character ? Cast<USkeletalMeshComponentBudgeted>(Character->GetMesh()) : nullptr;
+		if (!Mesh)
+		{
+			Characters.RemoveAtSwap(Index);
+			continue;
+		}
+
+		const bool bNeverSkip = ShouldNeverSkip(Character, Mesh);
+		NumNeverSkip += bNeverSkip ? 1 : 0;
+
+		Allocator->SetComponentSignificance(Mesh, CalculateSignificance(Mesh, ViewLocation, ViewScale), bNeverSkip);
+	}
+
+	SET_DWORD_STAT(STAT_SoulAnimBudgetNeverSkip, NumNeverSkip);
+}
+
+float USoulAnimBudgetSubsystem::CalculateSignificance(const USkeletalMeshComponentBudgeted* Mesh, const FVector& ViewLocation, float ViewScale) const
+{
+	const FBoxSphereBounds& Bounds = Mesh->Bounds;
+	const float Distance = FMath::Max<float>(FVector::Dist(Bounds.Origin, ViewLocation), 1);
+
+	float Significance = FMath::Clamp<float>(Bounds.SphereRadius * ViewScale / Distance, 0, 1);
+
+	if (!Mesh->WasRecentlyRendered(0.2))
+	{
+		Significance *= OffscreenSignificanceScale;
+	}
+
+	return Significance;
+}
+
+bool USoulAnimBudgetSubsystem::ShouldNeverSkip(const ACharacter* Character, const USkeletalMeshComponentBudgeted* Mesh) const
+{
+	if (Character->IsLocallyControlled())
+	{
+		return true;
+	}
+
+	const ASoulCombatCharacterBase* SoulCharacter = Cast<ASoulCombatCharacterBase>(Character);
+	if (SoulCharacter && (SoulCharacter->GetStateBits() & (uint16)SoulCharacterState::NeverSkipAnimStates) != 0)
+	{
+		return true;
+	}
+
+	const UAnimInstance* AnimInstance = Mesh->GetAnimInstance();
+	return AnimInstance && AnimInstance->IsAnyMontagePlaying();
+}
\ No newline at end of file
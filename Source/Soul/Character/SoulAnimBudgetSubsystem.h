@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SoulAnimBudgetSubsystem.generated.h"
+
+class ACharacter;
+class IAnimationBudgetAllocator;
+class USkeletalMeshComponentBudgeted;
+
+UCLASS(Config = Game)
+class SOUL_API USoulAnimBudgetSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterCharacter(ACharacter* Character);
+	void UnregisterCharacter(ACharacter* Character);
+
+	// Re-submits one character right away so a combat state change does not wait for the next significance pass.
+	void RefreshCharacter(ACharacter* Character);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	void ApplyParameters(IAnimationBudgetAllocator* Allocator) const;
+
+	float CalculateSignificance(const USkeletalMeshComponentBudgeted* Mesh, const FVector& ViewLocation, float ViewScale) const;
+	bool ShouldNeverSkip(const ACharacter* Character, const USkeletalMeshComponentBudgeted* Mesh) const;
+
+protected:
+	UPROPERTY(Config)
+	float BudgetInMs = 1;
+
+	UPROPERTY(Config)
+	int32 MaxTickRate = 10;
+
+	UPROPERTY(Config)
+	int32 MaxInterpolatedComponents = 32;
+
+	UPROPERTY(Config)
+	float OffscreenSignificanceScale = 0.25;
+
+	TArray<TWeakObjectPtr<ACharacter>> Characters;
+
+	FVector LastViewLocation = FVector::ZeroVector;
+	float LastViewScale = 1;
+
+	bool bBudgetEnabled = false;
+};
\ No newline at end of file
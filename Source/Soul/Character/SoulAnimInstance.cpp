@@ -5,66 +5,115 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "KismetAnimationLibrary.h"
 
+void USoulAnimInstance::NativeInitializeAnimation()
+{
+	Super::NativeInitializeAnimation();
+
+	CachedPawn = TryGetPawnOwner();
+	CachedCharacter = Cast<ASoulCombatCharacterBase>(CachedPawn.Get());
+}
+
 void USoulAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 {
 	Super::NativeUpdateAnimation(DeltaSeconds);
 
-	APawn* Pawn = TryGetPawnOwner();
+	GatherSnapshot();
+
+	if (!bUseThreadSafeUpdate)
+	{
+		UpdateFromSnapshot();
+	}
+}
+
+void USoulAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	if (bUseThreadSafeUpdate)
+	{
+		UpdateFromSnapshot();
+	}
+}
+
+void USoulAnimInstance::GatherSnapshot()
+{
+	APawn* Pawn = CachedPawn.Get();
 	if (!::IsValid(Pawn))
+	{
+		Pawn = TryGetPawnOwner();
+		CachedPawn = Pawn;
+		CachedCharacter = Cast<ASoulCombatCharacterBase>(Pawn);
+	}
+
+	Snapshot.bHasPawn = ::IsValid(Pawn);
+	if (!Snapshot.bHasPawn)
 	{
 		return;
 	}
 
-	CachedCharacter = Cast<ASoulCharacter>(Pawn);
+	Snapshot.Velocity = Pawn->GetVelocity();
+	Snapshot.ActorRotation = Pawn->GetActorRotation();
 
-	FVector Velocity = Pawn->GetVelocity();
-	Speed = Velocity.Size();
+	ASoulCombatCharacterBase* Character = CachedCharacter.Get();
+	Snapshot.bHasCharacter = Character != nullptr;
+	if (!Character)
+	{
+		return;
+	}
+
+	Snapshot.AimRotation = Character->GetBaseAimRotation();
+	Snapshot.bIsFalling = Character->GetMovementComponent()->IsFalling();
+	Snapshot.WeaponType = Character->GetCurrentWeaponType();
+	Snapshot.bIsAiming = Character->GetIsAiming();
+	Snapshot.bIsAttacking = Character->GetIsAttacking();
+	Snapshot.bIsSprinting = Character->GetIsSprinting();
+	Snapshot.bIsDead = Character->GetIsDead();
+	Snapshot.bIsHit = Character->GetIsHit();
+	Snapshot.bOnLadder = Character->IsOnLadder();
+
+	const ASoulCharacter* Player = Snapshot.bOnLadder ? Cast<ASoulCharacter>(Character) : nullptr;
+	Snapshot.LadderInput = Player ? Player->GetLadderInput() : 0;
+}
+
+void USoulAnimInstance::UpdateFromSnapshot()
+{
+	if (!Snapshot.bHasPawn)
+	{
+		return;
+	}
 
-	FRotator Rotation = Pawn->GetActorRotation();
-	Direction = UKismetAnimationLibrary::CalculateDirection(Velocity, Rotation);
+	Speed = Snapshot.Velocity.Size();
+	Direction = UKismetAnimationLibrary::CalculateDirection(Snapshot.Velocity, Snapshot.ActorRotation);
 
-	if (!CachedCharacter.IsValid())
+	if (!Snapshot.bHasCharacter)
 	{
 		IsInAir = false;
 		CurrentWeaponType = EWeaponType::Empty;
 		return;
 	}
 
-	IsInAir = CachedCharacter->GetMovementComponent()->IsFalling();
-	CurrentWeaponType = CachedCharacter->GetCurrentWeaponType();
-	bIsAiming = CachedCharacter->GetIsAiming();
-
-	const FRotator AimRot = CachedCharacter->GetBaseAimRotation();
-	const FRotator ActorRot = CachedCharacter->GetActorRotation();
+	IsInAir = Snapshot.bIsFalling;
+	CurrentWeaponType = Snapshot.WeaponType;
+	bIsAiming = Snapshot.bIsAiming;
 
-	FRotator DeltaRot = (AimRot - ActorRot).GetNormalized();
+	FRotator DeltaRot = (Snapshot.AimRotation - Snapshot.ActorRotation).GetNormalized();
 	AimPitch = DeltaRot.Pitch;
 
-	bIsDead = CachedCharacter->GetIsDead();
-	bIsHit = CachedCharacter->GetIsHit();
+	bIsDead = Snapshot.bIsDead;
+	bIsHit = Snapshot.bIsHit;
 
-	bOnLadder = CachedCharacter->IsOnLadder();
-	LadderSpeed = CachedCharacter->GetLadderInput();
+	bOnLadder = Snapshot.bOnLadder;
+	LadderSpeed = Snapshot.LadderInput;
 }
 
 bool USoulAnimInstance::IsAttacking() const
 {
-	if (!CachedCharacter.IsValid())
-	{
-		return false;
-	}
-
-	return CachedCharacter->GetIsAttacking();
+	return Snapshot.bHasCharacter && Snapshot.bIsAttacking;
 }
 
 bool USoulAnimInstance::IsSprinting() const
 {
-	if (!CachedCharacter.IsValid())
-	{
-		return false;
-	}
-
-	return CachedCharacter->GetIsSprinting();
+	return Snapshot.bHasCharacter && Snapshot.bIsSprinting;
 }
 
 ECharacterAnimState USoulAnimInstance::GetCharacterState() const
@@ -103,48 +152,47 @@ void USoulAnimInstance::PlayGunAttackMontage()
 	Montage_Play(GunFireMontage, 1);
 }
 
-void USoulAnimInstance::JumpToAttackMontageSection(int32 NewSection)
+void USoulAnimInstance::JumpToAttackMontageSection(FName SectionName)
 {
-	if (!AttackMontage)
+	if (!AttackMontage || SectionName.IsNone())
 	{
 		return;
 	}
 
-	Montage_JumpToSection(GetAttackMontageSectionName(NewSection), AttackMontage);
+	Montage_JumpToSection(SectionName, AttackMontage);
 }
 
 void USoulAnimInstance::AnimNotify_AttackHitCheck()
 {
-	OnAttackHitCheck.Broadcast();
+	DispatchAnimEvent(ESoulAnimEvent::AttackHitCheck);
 }
 
 void USoulAnimInstance::AnimNotify_NextAttackCheck()
 {
-	OnNextAttackCheck.Broadcast();
+	DispatchAnimEvent(ESoulAnimEvent::NextAttackCheck);
 }
 
-FName USoulAnimInstance::GetAttackMontageSectionName(int32 Section)
+void USoulAnimInstance::DispatchAnimEvent(ESoulAnimEvent Event)
 {
-	if (!ensureMsgf(FMath::IsWithinInclusive<int32>(Section, 1, 4), TEXT("GetAttackMontageSectionName error: Section %d is out of range (1~4)"), Section))
+	if (ASoulCombatCharacterBase* Character = CachedCharacter.Get())
 	{
-		return NAME_None;
+		Character->HandleAnimEvent(Event);
 	}
-	return FName(*FString::Printf(TEXT("Attack%d"), Section));
 }
 
 void USoulAnimInstance::AnimNotify_GunShot()
 {
-	OnGunShot.Broadcast();
+	DispatchAnimEvent(ESoulAnimEvent::GunShot);
 }
 
 void USoulAnimInstance::AnimNotify_GunCanReShot()
 {
-	OnGunCanReShot.Broadcast();
+	DispatchAnimEvent(ESoulAnimEvent::GunCanReShot);
 }
 
 void USoulAnimInstance::AnimNotify_GunShotEnd()
 {
-	OnGunShotEnd.Broadcast();
+	DispatchAnimEvent(ESoulAnimEvent::GunShotEnd);
 }
 
 void USoulAnimInstance::PlayDodgeMontage()
@@ -159,17 +207,17 @@ void USoulAnimInstance::PlayDodgeMontage()
 
 void USoulAnimInstance::AnimNotify_DodgeIFrameOn()
 {
-	OnDodgeIFrameOn.Broadcast();
+	DispatchAnimEvent(ESoulAnimEvent::DodgeIFrameOn);
 }
 
 void USoulAnimInstance::AnimNotify_DodgeIFrameOff()
 {
-	OnDodgeIFrameOff.Broadcast();
+	DispatchAnimEvent(ESoulAnimEvent::DodgeIFrameOff);
 }
 
 void USoulAnimInstance::AnimNotify_DodgeEnd()
 {
-	OnDodgeEnd.Broadcast();
+	DispatchAnimEvent(ESoulAnimEvent::DodgeEnd);
 }
 
 void USoulAnimInstance::PlayHitReactMontage()
@@ -234,10 +282,10 @@ void USoulAnimInstance::PlayLadderTopExitMontage()
 
 void USoulAnimInstance::AnimNotify_LadderTopMountEnd()
 {
-	OnLadderTopMountEnd.Broadcast();
+	DispatchAnimEvent(ESoulAnimEvent::LadderTopMountEnd);
 }
 
 void USoulAnimInstance::AnimNotify_LadderTopExitEnd()
 {
-	OnLadderTopExitEnd.Broadcast();
+	DispatchAnimEvent(ESoulAnimEvent::LadderTopExitEnd);
 }
\ No newline at end of file
@@ -5,17 +5,6 @@
 #include "SoulCharacter.h"
 #include "SoulAnimInstance.generated.h"
 
-DECLARE_MULTICAST_DELEGATE(FOnNextAttackCheckDelegate);
-DECLARE_MULTICAST_DELEGATE(FOnAttackHitCheckDelegate);
-DECLARE_MULTICAST_DELEGATE(FOnGunShotDelegate);
-DECLARE_MULTICAST_DELEGATE(FOnGunCanReShotDelegate);
-DECLARE_MULTICAST_DELEGATE(FOnGunShotEndDelegate);
-DECLARE_MULTICAST_DELEGATE(FOnDodgeIFrameOnDelegate);
-DECLARE_MULTICAST_DELEGATE(FOnDodgeIFrameOffDelegate);
-DECLARE_MULTICAST_DELEGATE(FOnDodgeEndDelegate);
-DECLARE_MULTICAST_DELEGATE(FOnLadderTopMountEnd);
-DECLARE_MULTICAST_DELEGATE(FOnLadderTopExitEnd);
-
 UENUM(BlueprintType)
 enum class ECharacterAnimState : uint8
 {
@@ -28,26 +17,46 @@ enum class ECharacterAnimState : uint8
 
 class ASoulCharacter;
 
+struct FSoulAnimSnapshot
+{
+	FVector Velocity = FVector::ZeroVector;
+	FRotator ActorRotation = FRotator::ZeroRotator;
+	FRotator AimRotation = FRotator::ZeroRotator;
+	float LadderInput = 0;
+	EWeaponType WeaponType = EWeaponType::Empty;
+	bool bHasPawn = false;
+	bool bHasCharacter = false;
+	bool bIsFalling = false;
+	bool bIsAiming = false;
+	bool bIsAttacking = false;
+	bool bIsSprinting = false;
+	bool bIsDead = false;
+	bool bIsHit = false;
+	bool bOnLadder = false;
+};
+
 UCLASS()
 class SOUL_API USoulAnimInstance : public UAnimInstance
 {
 	GENERATED_BODY()
 	
 public:
+	virtual void NativeInitializeAnimation() override;
 	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
 
-	UFUNCTION(BlueprintPure, Category = "Pawn")
+	UFUNCTION(BlueprintPure, Category = "Pawn", Meta = (BlueprintThreadSafe))
 	bool IsAttacking() const;
 
-	UFUNCTION(BlueprintPure, Category = "Pawn")
+	UFUNCTION(BlueprintPure, Category = "Pawn", Meta = (BlueprintThreadSafe))
 	bool IsSprinting() const;
 
-	UFUNCTION(BlueprintPure, Category = "Pawn")
+	UFUNCTION(BlueprintPure, Category = "Pawn", Meta = (BlueprintThreadSafe))
 	ECharacterAnimState GetCharacterState() const;
 
 	void PlaySwordAttackMontage();
 	void PlayGunAttackMontage();
-	void JumpToAttackMontageSection(int32 NewSection);
+	void JumpToAttackMontageSection(FName SectionName);
 
 	void PlayDodgeMontage();
 
@@ -66,7 +75,10 @@ protected:
 	UFUNCTION()
 	void AnimNotify_NextAttackCheck();
 
-	FORCEINLINE FName GetAttackMontageSectionName(int32 Section);
+	void DispatchAnimEvent(ESoulAnimEvent Event);
+
+	void GatherSnapshot();
+	void UpdateFromSnapshot();
 
 	UFUNCTION()
 	void AnimNotify_GunShot();
@@ -92,18 +104,6 @@ protected:
 	UFUNCTION()
 	void AnimNotify_LadderTopExitEnd();
 
-public:
-	FOnNextAttackCheckDelegate OnNextAttackCheck;
-	FOnAttackHitCheckDelegate OnAttackHitCheck;
-	FOnGunShotDelegate OnGunShot;
-	FOnGunCanReShotDelegate OnGunCanReShot;
-	FOnGunShotEndDelegate  OnGunShotEnd;
-	FOnDodgeIFrameOnDelegate  OnDodgeIFrameOn;
-	FOnDodgeIFrameOffDelegate OnDodgeIFrameOff;
-	FOnDodgeEndDelegate OnDodgeEnd;
-	FOnLadderTopMountEnd OnLadderTopMountEnd;
-	FOnLadderTopExitEnd OnLadderTopExitEnd;
-
 protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Attack", Meta = (AllowPrivateAccess = true))
 	TObjectPtr<UAnimMontage> AttackMontage;
@@ -144,7 +144,14 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Pawn", Meta = (AllowPrivateAccess = true))
 	bool bIsDead = false;
 
-	TWeakObjectPtr<class ASoulCharacter> CachedCharacter;
+	TWeakObjectPtr<class ASoulCombatCharacterBase> CachedCharacter;
+
+	TWeakObjectPtr<APawn> CachedPawn;
+
+	FSoulAnimSnapshot Snapshot;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Performance")
+	bool bUseThreadSafeUpdate = true;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Weapon")
 	bool bIsAiming = false;
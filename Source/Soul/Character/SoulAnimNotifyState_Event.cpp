@@ -0,0 +1,35 @@
+#include "SoulAnimNotifyState_Event.h"
+#include "SoulCombatCharacterBase.h"
+
+#include "Components/SkeletalMeshComponent.h"
+
+USoulAnimNotifyState_Event::USoulAnimNotifyState_Event()
+{
+	bIsNativeBranchingPoint = true;
+}
+
+void USoulAnimNotifyState_Event::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
+{
+	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
+
+	if (ASoulCombatCharacterBase* Character = MeshComp ? Cast<ASoulCombatCharacterBase>(MeshComp->GetOwner()) : nullptr)
+	{
+		Character->HandleAnimEvent(BeginEvent);
+	}
+}
+
+void USoulAnimNotifyState_Event::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	Super::NotifyEnd(MeshComp, Animation, EventReference);
+
+	if (ASoulCombatCharacterBase* Character = MeshComp ? Cast<ASoulCombatCharacterBase>(MeshComp->GetOwner()) : nullptr)
+	{
+		Character->HandleAnimEvent(EndEvent);
+	}
+}
+
+FString USoulAnimNotifyState_Event::GetNotifyName_Implementation() const
+{
+	const UEnum* EventEnum = StaticEnum<ESoulAnimEvent>();
+	return FString::Printf(TEXT("%s / %s"), *EventEnum->GetDisplayNameTextByValue((int64)BeginEvent).ToString(), *EventEnum->GetDisplayNameTextByValue((int64)EndEvent).ToString());
+}
\ No newline at end of file
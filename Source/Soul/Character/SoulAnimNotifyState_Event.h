@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimNotifies/AnimNotifyState.h"
+#include "../Common/AnimEventTypes.h"
+#include "SoulAnimNotifyState_Event.generated.h"
+
+UCLASS(meta = (DisplayName = "Soul Event Window"))
+class SOUL_API USoulAnimNotifyState_Event : public UAnimNotifyState
+{
+	GENERATED_BODY()
+
+public:
+	USoulAnimNotifyState_Event();
+
+	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
+	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+
+	virtual FString GetNotifyName_Implementation() const override;
+
+protected:
+	UPROPERTY(EditAnywhere, Category = "Event")
+	ESoulAnimEvent BeginEvent = ESoulAnimEvent::DodgeIFrameOn;
+
+	UPROPERTY(EditAnywhere, Category = "Event")
+	ESoulAnimEvent EndEvent = ESoulAnimEvent::DodgeIFrameOff;
+};
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "SoulAnimNotifyState_HitWindow.h"
+#include "SoulCombatCharacterBase.h"
+
+#include "Components/SkeletalMeshComponent.h"
+
+void USoulAnimNotifyState_HitWindow::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
+{
+	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
+
+	if (ASoulCombatCharacterBase* Character = MeshComp ? Cast<ASoulCombatCharacterBase>(MeshComp->GetOwner()) : nullptr)
+	{
+		Character->BeginSwordHitWindow();
+	}
+}
+
+void USoulAnimNotifyState_HitWindow::NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
+{
+	Super::NotifyTick(MeshComp, Animation, FrameDeltaTime, EventReference);
+
+	if (ASoulCombatCharacterBase* Character = MeshComp ? Cast<ASoulCombatCharacterBase>(MeshComp->GetOwner()) : nullptr)
+	{
+		Character->TickSwordHitWindow(FrameDeltaTime);
+	}
+}
+
+void USoulAnimNotifyState_HitWindow::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	Super::NotifyEnd(MeshComp, Animation, EventReference);
+
+	if (ASoulCombatCharacterBase* Character = MeshComp ? Cast<ASoulCombatCharacterBase>(MeshComp->GetOwner()) : nullptr)
+	{
+		Character->EndSwordHitWindow();
+	}
+}
+
+FString USoulAnimNotifyState_HitWindow::GetNotifyName_Implementation() const
+{
+	return TEXT("Hit Window");
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+#include "SoulAnimNotify_Event.h"
+#include "SoulCombatCharacterBase.h"
+
+#include "Components/SkeletalMeshComponent.h"
+
+USoulAnimNotify_Event::USoulAnimNotify_Event()
+{
+	bIsNativeBranchingPoint = true;
+}
+
+void USoulAnimNotify_Event::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	Super::Notify(MeshComp, Animation, EventReference);
+
+	if (ASoulCombatCharacterBase* Character = MeshComp ? Cast<ASoulCombatCharacterBase>(MeshComp->GetOwner()) : nullptr)
+	{
+		Character->HandleAnimEvent(Event);
+	}
+}
+
+FString USoulAnimNotify_Event::GetNotifyName_Implementation() const
+{
+	return StaticEnum<ESoulAnimEvent>()->GetDisplayNameTextByValue((int64)Event).ToString();
+}
\ No newline at end of file
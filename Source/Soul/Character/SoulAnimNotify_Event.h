@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimNotifies/AnimNotify.h"
+#include "../Common/AnimEventTypes.h"
+#include "SoulAnimNotify_Event.generated.h"
+
+UCLASS(meta = (DisplayName = "Soul Event"))
+class SOUL_API USoulAnimNotify_Event : public UAnimNotify
+{
+	GENERATED_BODY()
+
+public:
+	USoulAnimNotify_Event();
+
+	virtual void Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+
+	virtual FString GetNotifyName_Implementation() const override;
+
+protected:
+	UPROPERTY(EditAnywhere, Category = "Event")
+	ESoulAnimEvent Event = ESoulAnimEvent::AttackHitCheck;
+};
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include "SoulCameraRigComponent.h"
+
+#include "Camera/CameraComponent.h"
+#include "Curves/CurveFloat.h"
+#include "GameFramework/SpringArmComponent.h"
+
+USoulCameraRigComponent::USoulCameraRigComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PostPhysics;
+
+	AimProfile.FieldOfView = 70;
+	AimProfile.ArmLength = 150;
+	AimProfile.SocketOffset = FVector(0, 50, 40);
+}
+
+void USoulCameraRigComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (AActor* Owner = GetOwner())
+	{
+		CameraBoom = Owner->FindComponentByClass<USpringArmComponent>();
+		FollowCamera = Owner->FindComponentByClass<UCameraComponent>();
+	}
+
+	DefaultProfile = CaptureCurrentProfile();
+	TargetProfile = DefaultProfile;
+}
+
+void USoulCameraRigComponent::SetAiming(bool bNewAiming)
+{
+	if (bAiming == bNewAiming)
+	{
+		return;
+	}
+
+	bAiming = bNewAiming;
+
+	if (bAiming)
+	{
+		StartTransition(AimProfile, AimInDuration, AimInCurve);
+	}
+	else
+	{
+		StartTransition(DefaultProfile, AimOutDuration, AimOutCurve);
+	}
+}
+
+void USoulCameraRigComponent::StartTransition(const FSoulCameraProfile& NewTarget, float Duration, const UCurveFloat* Curve)
+{
+	FromProfile = CaptureCurrentProfile();
+	TargetProfile = NewTarget;
+	ActiveCurve = Curve;
+	TransitionDuration = Duration;
+	TransitionElapsed = 0;
+
+	if (TransitionDuration <= 0)
+	{
+		ApplyProfile(TargetProfile);
+		SetComponentTickEnabled(false);
+		return;
+	}
+
+	SetComponentTickEnabled(true);
+}
+
+void USoulCameraRigComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	TransitionElapsed += DeltaTime;
+
+	const float Alpha = FMath::Clamp<float>(TransitionElapsed / TransitionDuration, 0, 1);
+	const float BlendAlpha = ActiveCurve ? ActiveCurve->GetFloatValue(Alpha) : FMath::SmoothStep<float>(0, 1, Alpha);
+
+	FSoulCameraProfile Blended;
+	Blended.FieldOfView = FMath::Lerp(FromProfile.FieldOfView, TargetProfile.FieldOfView, BlendAlpha);
+	Blended.ArmLength = FMath::Lerp(FromProfile.ArmLength, TargetProfile.ArmLength, BlendAlpha);
+	Blended.SocketOffset = FMath::Lerp(FromProfile.SocketOffset, TargetProfile.SocketOffset, BlendAlpha);
+
+	if (Alpha >= 1)
+	{
+		ApplyProfile(TargetProfile);
+		SetComponentTickEnabled(false);
+		return;
+	}
+
+	ApplyProfile(Blended);
+}
+
+FSoulCameraProfile USoulCameraRigComponent::CaptureCurrentProfile() const
+{
+	FSoulCameraProfile Profile = DefaultProfile;
+
+	if (FollowCamera)
+	{
+		Profile.FieldOfView = FollowCamera->FieldOfView;
+	}
+
+	if (CameraBoom)
+	{
+		Profile.ArmLength = CameraBoom->TargetArmLength;
+		Profile.SocketOffset = CameraBoom->SocketOffset;
+	}
+
+	return Profile;
+}
+
+void USoulCameraRigComponent::ApplyProfile(const FSoulCameraProfile& Profile)
+{
+	if (FollowCamera)
+	{
+		FollowCamera->SetFieldOfView(Profile.FieldOfView);
+	}
+
+	if (CameraBoom)
+	{
+		CameraBoom->TargetArmLength = Profile.ArmLength;
+		CameraBoom->SocketOffset = Profile.SocketOffset;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "SoulCameraRigComponent.generated.h"
+
+class USpringArmComponent;
+class UCameraComponent;
+class UCurveFloat;
+
+USTRUCT(BlueprintType)
+struct FSoulCameraProfile
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera")
+	float FieldOfView = 90;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera")
+	float ArmLength = 400;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Camera")
+	FVector SocketOffset = FVector::ZeroVector;
+};
+
+UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
+class SOUL_API USoulCameraRigComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	USoulCameraRigComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	void SetAiming(bool bNewAiming);
+
+	FORCEINLINE bool IsTransitioning() const { return IsComponentTickEnabled(); }
+
+protected:
+	virtual void BeginPlay() override;
+
+	void StartTransition(const FSoulCameraProfile& NewTarget, float Duration, const UCurveFloat* Curve);
+	FSoulCameraProfile CaptureCurrentProfile() const;
+	void ApplyProfile(const FSoulCameraProfile& Profile);
+
+protected:
+	UPROPERTY(VisibleInstanceOnly, Category = "Camera")
+	FSoulCameraProfile DefaultProfile;
+
+	UPROPERTY(EditAnywhere, Category = "Camera")
+	FSoulCameraProfile AimProfile;
+
+	UPROPERTY(EditAnywhere, Category = "Camera", meta = (ClampMin = "0"))
+	float AimInDuration = 0.15;
+
+	UPROPERTY(EditAnywhere, Category = "Camera", meta = (ClampMin = "0"))
+	float AimOutDuration = 0.25;
+
+	UPROPERTY(EditAnywhere, Category = "Camera")
+	TObjectPtr<UCurveFloat> AimInCurve;
+
+	UPROPERTY(EditAnywhere, Category = "Camera")
+	TObjectPtr<UCurveFloat> AimOutCurve;
+
+	UPROPERTY()
+	TObjectPtr<USpringArmComponent> CameraBoom;
+
+	UPROPERTY()
+	TObjectPtr<UCameraComponent> FollowCamera;
+
+	UPROPERTY()
+	TObjectPtr<const UCurveFloat> ActiveCurve;
+
+	FSoulCameraProfile FromProfile;
+	FSoulCameraProfile TargetProfile;
+
+	float TransitionDuration = 0;
+	float TransitionElapsed = 0;
+
+	bool bAiming = false;
+};
\ No newline at end of file
@@ -1,54 +1,55 @@
 #include "SoulCharacter.h"
 #include "SoulAnimInstance.h"
 #include "../Game/SoulPlayerController.h"
-#include "SoulCharacterStatComponent.h"
-#include "../UI/FloatingDamageActor.h"
 #include "../Interact/SoulInteractableInterface.h"
 #include "../Interact/SoulLadderActor.h"
 #include "SoulWeaponComponent.h"
+#include "SoulCharacterStatComponent.h"
+#include "SoulLockOnComponent.h"
+#include "SoulCameraRigComponent.h"
+#include "SoulCharacterMovementComponent.h"
+#include "../Common/SoulStats.h"
+#include "../Common/SoulCombatTelemetry.h"
+#include "../Combat/SoulShotQueueSubsystem.h"
+#include "../Combat/SoulProjectileSubsystem.h"
+#include "SoulWeaponData.h"
 
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "Camera/CameraComponent.h"
-#include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "GameFramework/Controller.h"
 
-#include "Kismet/GameplayStatics.h"
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Buffered Input Latency (ms)"), STAT_SoulBufferedInputLatency, STATGROUP_Soul);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Buffered Inputs Executed"), STAT_SoulBufferedInputsExecuted, STATGROUP_Soul);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Buffered Inputs Expired"), STAT_SoulBufferedInputsExpired, STATGROUP_Soul);
+DECLARE_CYCLE_STAT(TEXT("Player Character Tick"), STAT_SoulPlayerCharacterTick, STATGROUP_Soul);
 
-ASoulCharacter::ASoulCharacter()
+ASoulCharacter::ASoulCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<USoulCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
 	PrimaryActorTick.bCanEverTick = true;
 
-	GetCapsuleComponent()->InitCapsuleSize(42, 96);
-
-	bUseControllerRotationPitch = false;
-	bUseControllerRotationYaw = false;
-	bUseControllerRotationRoll = false;
-
-	GetCharacterMovement()->bOrientRotationToMovement = true;
-	GetCharacterMovement()->bUseControllerDesiredRotation = true;
-	GetCharacterMovement()->RotationRate = FRotator(0, 500, 0);
-
-	GetCharacterMovement()->MinAnalogWalkSpeed = 20;
-	GetCharacterMovement()->BrakingDecelerationWalking = 2000;
-	GetCharacterMovement()->BrakingDecelerationFalling = 1500;
-
 	CameraBoom = CreateDefaultSubobject<USpringArmComponent>(TEXT("CameraBoom"));
 	CameraBoom->SetupAttachment(RootComponent);
-	CameraBoom->TargetArmLength = DefaultArmLength;
+	CameraBoom->TargetArmLength = 400;
 	CameraBoom->bUsePawnControlRotation = true;
 
 	FollowCamera = CreateDefaultSubobject<UCameraComponent>(TEXT("FollowCamera"));
 	FollowCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName);
 	FollowCamera->bUsePawnControlRotation = false;
 
+	CameraRig = CreateDefaultSubobject<USoulCameraRigComponent>(TEXT("CameraRig"));
+
 	UpdateMovementSpeed();
 
-	StatComp = CreateDefaultSubobject<USoulCharacterStatComponent>(TEXT("StatComponent"));
+	LockOnComp = CreateDefaultSubobject<USoulLockOnComponent>(TEXT("LockOnComp"));
+}
 
-	WeaponComp = CreateDefaultSubobject<USoulWeaponComponent>(TEXT("WeaponComp"));
+USoulCharacterMovementComponent* ASoulCharacter::GetSoulMovement() const
+{
+	return Cast<USoulCharacterMovementComponent>(GetCharacterMovement());
 }
 
 void ASoulCharacter::BeginPlay()
@@ -61,90 +62,209 @@ void ASoulCharacter::BeginPlay()
 
 		Subsystem->AddMappingContext(DefaultMappingContext, 0);
 	}
+}
+
+void ASoulCharacter::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
 
-	if (FollowCamera)
+	if (LockOnComp)
 	{
-		DefaultFOV = FollowCamera->FieldOfView;
+		LockOnComp->OnLockOnTargetChanged.AddUObject(this, &ASoulCharacter::OnLockOnTargetChanged);
 	}
 
-	if (CameraBoom)
+	if (StatComp)
 	{
-		DefaultArmLength = CameraBoom->TargetArmLength;
-		DefaultSocketOffset = CameraBoom->SocketOffset;
+		StatComp->OnStaminaExhausted.AddDynamic(this, &ASoulCharacter::OnStaminaExhausted);
 	}
+}
 
-	if (WeaponComp && DefaultSwordData)
+const ASoulCharacter::FAnimEventHandler ASoulCharacter::AnimEventHandlers[] =
+{
+	&ASoulCharacter::OnNextAttackCheck,
+	&ASoulCharacter::AttackCheck,
+	&ASoulCharacter::DoGunShot,
+	&ASoulCharacter::OnGunCanReShot,
+	&ASoulCharacter::OnGunShotEnd,
+	&ASoulCharacter::StartDodgeInvincible,
+	&ASoulCharacter::EndDodgeInvincible,
+	&ASoulCharacter::OnDodgeFinished,
+	&ASoulCharacter::OnLadderTopMountEnd,
+	&ASoulCharacter::OnLadderTopExitEnd,
+};
+
+void ASoulCharacter::HandleAnimEvent(ESoulAnimEvent Event)
+{
+	static_assert(UE_ARRAY_COUNT(AnimEventHandlers) == (int32)ESoulAnimEvent::Count, "AnimEventHandlers needs one entry per ESoulAnimEvent");
+
+	const uint8 Index = (uint8)Event;
+	if (Index >= (uint8)ESoulAnimEvent::Count)
 	{
-		WeaponComp->GiveWeapon(DefaultSwordData);
+		return;
 	}
 
-	CurrentWeaponType = EWeaponType::Empty;
+	(this->*AnimEventHandlers[Index])();
 }
 
-void ASoulCharacter::PostInitializeComponents()
+void ASoulCharacter::OnLadderTopMountEnd()
 {
-	Super::PostInitializeComponents();
-	AnimInstance = Cast<USoulAnimInstance>(GetMesh()->GetAnimInstance());
+	if (!CurrentLadder.IsValid())
+	{
+		return;
+	}
 
-	if (AnimInstance == nullptr)
+	EnterLadderMode();
+	SetState(ESoulCharacterState::LadderMounting, false);
+}
+
+void ASoulCharacter::OnLadderTopExitEnd()
+{
+	if (!CurrentLadder.IsValid())
 	{
 		return;
 	}
 
-	AnimInstance->OnMontageEnded.AddDynamic(this, &ASoulCharacter::OnAttackMontageEnded);
+	EndLadder();
+	SetState(ESoulCharacterState::LadderMounting, false);
+}
 
-	AnimInstance->OnNextAttackCheck.AddLambda([this]() -> void {
-		CanNextCombo = true;
+void ASoulCharacter::OnStateBitsChanged(uint16 OldBits, uint16 NewBits)
+{
+	const bool bAimingChanged = ((OldBits ^ NewBits) & (uint16)ESoulCharacterState::Aiming) != 0;
 
-		if (IsComboInputOn)
-		{
-			AttackStartComboState();
-			AnimInstance->JumpToAttackMontageSection(CurrentCombo);
-		}
-	});
+	if (bAimingChanged && CameraRig)
+	{
+		CameraRig->SetAiming(HasState(ESoulCharacterState::Aiming));
+	}
 
-	AnimInstance->OnGunShot.AddUObject(this, &ASoulCharacter::DoGunShot);
-	AnimInstance->OnGunCanReShot.AddUObject(this, &ASoulCharacter::OnGunCanReShot);
-	AnimInstance->OnGunShotEnd.AddUObject(this, &ASoulCharacter::OnGunShotEnd);
+	constexpr uint16 DrainBits = (uint16)ESoulCharacterState::Sprinting | (uint16)ESoulCharacterState::Aiming;
+	if ((OldBits ^ NewBits) & DrainBits)
+	{
+		UpdateStaminaDrain();
+	}
+}
 
-	AnimInstance->OnAttackHitCheck.AddUObject(this, &ASoulCharacter::AttackCheck);
+void ASoulCharacter::UpdateStaminaDrain()
+{
+	if (!StatComp)
+	{
+		return;
+	}
 
-	AnimInstance->OnDodgeIFrameOn.AddUObject(this, &ASoulCharacter::StartDodgeInvincible);
-	AnimInstance->OnDodgeIFrameOff.AddUObject(this, &ASoulCharacter::EndDodgeInvincible);
-	AnimInstance->OnDodgeEnd.AddUObject(this, &ASoulCharacter::OnDodgeFinished);
-	
-	if (StatComp)
+	float DrainRate = 0;
+	if (HasState(ESoulCharacterState::Sprinting))
+	{
+		DrainRate += SprintStaminaPerSecond;
+	}
+	if (HasState(ESoulCharacterState::Aiming))
 	{
-		StatComp->OnDead.AddDynamic(this, &ASoulCharacter::HandleDead);
+		DrainRate += AimStaminaPerSecond;
 	}
 
-	AnimInstance->OnLadderTopMountEnd.AddLambda([this]()
-		{
-			if (!CurrentLadder.IsValid())
-			{
-				return;
-			}
+	StatComp->SetStaminaDrainRate(DrainRate);
+}
 
-			FVector SnapLoc; FRotator SnapRot;
-			CurrentLadder->GetSnapTransform(this, SnapLoc, SnapRot);
-			SetActorLocation(SnapLoc);
-			SetActorRotation(SnapRot);
+void ASoulCharacter::OnStaminaExhausted()
+{
+	StopAiming();
 
-			EnterLadderMode();
-			bLadderMounting = false;
-		});
+	if (HasState(ESoulCharacterState::Sprinting))
+	{
+		SetState(ESoulCharacterState::Sprinting, false);
+		UpdateMovementSpeed();
+	}
+}
+
+void ASoulCharacter::OnActionWindowOpened()
+{
+	ConsumeBufferedInputs();
+}
+
+void ASoulCharacter::BufferInput(ESoulBufferedAction Action)
+{
+	if (GetInputBufferWindow(Action) <= 0)
+	{
+		return;
+	}
+
+	InputBuffer.Push(Action, GetWorld()->GetRealTimeSeconds());
+}
+
+void ASoulCharacter::ConsumeBufferedInputs()
+{
+	if (InputBuffer.GetNum() == 0)
+	{
+		return;
+	}
 
-	AnimInstance->OnLadderTopExitEnd.AddLambda([this]()
+	const double Now = GetWorld()->GetRealTimeSeconds();
+
+	for (int32 Offset = 0; Offset < InputBuffer.GetNum(); ++Offset)
+	{
+		FSoulBufferedInput& Entry = InputBuffer.GetFromOldest(Offset);
+		if (Entry.Action == ESoulBufferedAction::None)
 		{
-			if (!CurrentLadder.IsValid())
-			{
-				return;
-			}
+			continue;
+		}
 
-			const FVector ExitLoc = CurrentLadder->GetTopExitLocation();
-			EndLadder();
-			bLadderMounting = false;
-		});
+		const double Age = Now - Entry.Timestamp;
+		if (Age > GetInputBufferWindow(Entry.Action))
+		{
+			Entry.Action = ESoulBufferedAction::None;
+			INC_DWORD_STAT(STAT_SoulBufferedInputsExpired);
+			continue;
+		}
+
+		if (ExecuteBufferedAction(Entry.Action))
+		{
+			Entry.Action = ESoulBufferedAction::None;
+			INC_DWORD_STAT(STAT_SoulBufferedInputsExecuted);
+			SET_FLOAT_STAT(STAT_SoulBufferedInputLatency, Age * 1000);
+			break;
+		}
+	}
+
+	InputBuffer.TrimConsumed();
+}
+
+bool ASoulCharacter::ExecuteBufferedAction(ESoulBufferedAction Action)
+{
+	switch (Action)
+	{
+	case ESoulBufferedAction::LightAttack:
+		return TryAttack(ESoulComboInput::Light);
+
+	case ESoulBufferedAction::HeavyAttack:
+		return TryAttack(ESoulComboInput::Heavy);
+
+	case ESoulBufferedAction::Dodge:
+		return TryDodge();
+
+	case ESoulBufferedAction::SwapGun:
+		return TrySwapGun();
+
+	default:
+		return false;
+	}
+}
+
+float ASoulCharacter::GetInputBufferWindow(ESoulBufferedAction Action) const
+{
+	switch (Action)
+	{
+	case ESoulBufferedAction::LightAttack:
+	case ESoulBufferedAction::HeavyAttack:
+		return AttackInputBufferWindow;
+
+	case ESoulBufferedAction::Dodge:
+		return DodgeInputBufferWindow;
+
+	case ESoulBufferedAction::SwapGun:
+		return SwapInputBufferWindow;
+
+	default:
+		return 0;
+	}
 }
 
 void ASoulCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -161,6 +281,11 @@ void ASoulCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCompo
 
 		EnhancedInputComponent->BindAction(AttackAction, ETriggerEvent::Started, this, &ASoulCharacter::Attack);
 
+		if (HeavyAttackAction)
+		{
+			EnhancedInputComponent->BindAction(HeavyAttackAction, ETriggerEvent::Started, this, &ASoulCharacter::HeavyAttack);
+		}
+
 		EnhancedInputComponent->BindAction(SwapSwordAction, ETriggerEvent::Started, this, &ASoulCharacter::SwapSword);
 		EnhancedInputComponent->BindAction(SwapGunAction, ETriggerEvent::Started, this, &ASoulCharacter::SwapGun);
 		EnhancedInputComponent->BindAction(SwapEmptyAction, ETriggerEvent::Started, this, &ASoulCharacter::SwapEmpty);
@@ -173,88 +298,51 @@ void ASoulCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCompo
 
 		EnhancedInputComponent->BindAction(MoveAction, ETriggerEvent::Completed, this, &ASoulCharacter::MoveCompleted);
 		EnhancedInputComponent->BindAction(MoveAction, ETriggerEvent::Canceled, this, &ASoulCharacter::MoveCompleted);
+
+		if (LockOnAction)
+		{
+			EnhancedInputComponent->BindAction(LockOnAction, ETriggerEvent::Started, this, &ASoulCharacter::ToggleLockOn);
+		}
+
+		if (SwitchLockOnTargetAction)
+		{
+			EnhancedInputComponent->BindAction(SwitchLockOnTargetAction, ETriggerEvent::Started, this, &ASoulCharacter::SwitchLockOnTarget);
+		}
 	}
 }
 
 void ASoulCharacter::Tick(float DeltaSeconds)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SoulPlayerCharacterTick);
+
 	Super::Tick(DeltaSeconds);
 
-	if (bIsAiming && GetCharacterMovement() && !GetCharacterMovement()->IsMovingOnGround())
+	if (HasState(ESoulCharacterState::Aiming) && GetCharacterMovement() && !GetCharacterMovement()->IsMovingOnGround())
 	{
 		StopAiming();
 	}
 
-	if (FollowCamera)
+	if (HasState(ESoulCharacterState::AutoFacing))
 	{
-		const float TargetFOV = bIsAiming ? AimFOV : DefaultFOV;
-		const float NewFOV = FMath::FInterpTo(FollowCamera->FieldOfView, TargetFOV, DeltaSeconds, FOVInterpSpeed);
-		FollowCamera->SetFieldOfView(NewFOV);
-	}
-
-	if (CameraBoom)
-	{
-		const float TargetArm = bIsAiming ? AimArmLength : DefaultArmLength;
-		CameraBoom->TargetArmLength = FMath::FInterpTo(CameraBoom->TargetArmLength, TargetArm, DeltaSeconds, CameraInterpSpeed);
-
-		const FVector TargetOffset = bIsAiming ? AimSocketOffset : DefaultSocketOffset;
-		CameraBoom->SocketOffset = FMath::VInterpTo(CameraBoom->SocketOffset, TargetOffset, DeltaSeconds, CameraInterpSpeed);
+		UpdateAutoFace(DeltaSeconds);
 	}
-
-	if (bAutoFacing)
+	else if (LockOnComp && LockOnComp->IsLockedOn())
 	{
-		UpdateAutoFace(DeltaSeconds);
+		UpdateLockOn(DeltaSeconds);
 	}
 
-	if (LocomotionState == ELocomotionState::Ladder)
+	if (IsOnLadder())
 	{
 		UpdateLadder(DeltaSeconds);
 	}
 
-	if (bTopMountMoving)
+	if (HasState(ESoulCharacterState::TopMountMoving))
 	{
 		UpdateTopMountMove(DeltaSeconds);
 		return;
 	}
 }
 
-float ASoulCharacter::TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
-{
-	if (bDodgeInvincible)
-	{
-		return 0;
-	}
-
-	const float ActualDamage = Super::TakeDamage(DamageAmount, DamageEvent, EventInstigator, DamageCauser);
-	const float FinalDamage = (ActualDamage > 0) ? ActualDamage : DamageAmount;
-
-	float AppliedDamage = 0;
-
-	if (StatComp)
-	{
-		if (FinalDamage > 0 && StatComp->ApplyDamage(FinalDamage))
-		{
-			OnHitDamage();
-			SpawnDamageText(this, FinalDamage);
-			AppliedDamage = FinalDamage;
-		}
-
-		UE_LOG(LogTemp, Log, TEXT("TakeDamage | Damage: %.2f | HP: %.2f / %.2f"), FinalDamage, StatComp->HP, StatComp->MaxHP);
-	}
-
-	return AppliedDamage;
-}
-
-void ASoulCharacter::Reset()
-{
-	Super::Reset();
-
-	if (StatComp)
-	{
-		StatComp->ResetCurrentToMax();
-	}
-}
-
 void ASoulCharacter::Move(const FInputActionValue& Value)
 {
 	if (GetController() == nullptr)
@@ -264,9 +352,14 @@ void ASoulCharacter::Move(const FInputActionValue& Value)
 
 	FVector2D MovementVector = Value.Get<FVector2D>();
 
-	if (LocomotionState == ELocomotionState::Ladder)
+	if (IsOnLadder())
 	{
 		LadderInput = MovementVector.Y;
+
+		if (!HasState(ESoulCharacterState::LadderMounting))
+		{
+			AddMovementInput(FVector::UpVector, LadderInput);
+		}
 		return;
 	}
 
@@ -288,6 +381,11 @@ void ASoulCharacter::Look(const FInputActionValue& Value)
 		return;
 	}
 
+	if (LockOnComp && LockOnComp->IsLockedOn())
+	{
+		return;
+	}
+
 	FVector2D LookAxisVector = Value.Get<FVector2D>();
 
 	AddControllerYawInput(LookAxisVector.X);
@@ -303,7 +401,7 @@ void ASoulCharacter::UpdateMovementSpeed()
 
 	float TargetSpeed = EmptyWalkSpeed;
 
-	if (bIsAiming && CurrentWeaponType == EWeaponType::Gun)
+	if (HasState(ESoulCharacterState::Aiming) && CurrentWeaponType == EWeaponType::Gun)
 	{
 		TargetSpeed = GunAimWalkSpeed;
 	}
@@ -312,7 +410,7 @@ void ASoulCharacter::UpdateMovementSpeed()
 		switch (CurrentWeaponType)
 		{
 		case EWeaponType::Sword:
-			TargetSpeed = bIsSprinting ? SwordSprintSpeed : SwordWalkSpeed;
+			TargetSpeed = HasState(ESoulCharacterState::Sprinting) ? SwordSprintSpeed : SwordWalkSpeed;
 			break;
 
 		case EWeaponType::Gun:
@@ -321,7 +419,7 @@ void ASoulCharacter::UpdateMovementSpeed()
 
 		case EWeaponType::Empty:
 		default:
-			TargetSpeed = bIsSprinting ? EmptySprintSpeed : EmptyWalkSpeed;
+			TargetSpeed = HasState(ESoulCharacterState::Sprinting) ? EmptySprintSpeed : EmptyWalkSpeed;
 			break;
 		}
 	}
@@ -329,14 +427,9 @@ void ASoulCharacter::UpdateMovementSpeed()
 	GetCharacterMovement()->MaxWalkSpeed = TargetSpeed;
 }
 
-bool ASoulCharacter::IsAnimationBlockingActions() const
-{
-	return AnimInstance && AnimInstance->IsAnyMontagePlaying();
-}
-
 void ASoulCharacter::SprintStart(const FInputActionValue& Value)
 {
-	if (LocomotionState == ELocomotionState::Ladder)
+	if (!CanPerform(ESoulCharacterAction::Sprint))
 	{
 		return;
 	}
@@ -351,9 +444,14 @@ void ASoulCharacter::SprintStart(const FInputActionValue& Value)
 		return;
 	}
 
+	if (StatComp && !StatComp->HasStamina())
+	{
+		return;
+	}
+
 	StopAiming();
 
-	bIsSprinting = true;
+	SetState(ESoulCharacterState::Sprinting, true);
 	UpdateMovementSpeed();
 }
 
@@ -364,20 +462,10 @@ void ASoulCharacter::SprintStop(const FInputActionValue& Value)
 		return;
 	}
 
-	bIsSprinting = false;
+	SetState(ESoulCharacterState::Sprinting, false);
 	UpdateMovementSpeed();
 }
 
-bool ASoulCharacter::IsGrounded() const
-{
-	if (const UCharacterMovementComponent* MoveComp = GetCharacterMovement())
-	{
-		return MoveComp->IsMovingOnGround();
-	}
-
-	return false;
-}
-
 void ASoulCharacter::SwapSword(const FInputActionValue& Value)
 {
 	if (!Value.Get<bool>())
@@ -385,7 +473,7 @@ void ASoulCharacter::SwapSword(const FInputActionValue& Value)
 		return;
 	}
 
-	if (LocomotionState == ELocomotionState::Ladder)
+	if (!CanPerform(ESoulCharacterAction::Swap))
 	{
 		return;
 	}
@@ -400,7 +488,7 @@ void ASoulCharacter::SwapSword(const FInputActionValue& Value)
 	if (WeaponComp && WeaponComp->EquipWeapon(EWeaponType::Sword))
 	{
 		CurrentWeaponType = EWeaponType::Sword;
-		bIsAiming = false;
+		SetState(ESoulCharacterState::Aiming, false);
 		UpdateMovementSpeed();
 	}
 }
@@ -412,22 +500,36 @@ void ASoulCharacter::SwapGun(const FInputActionValue& Value)
 		return;
 	}
 
-	if (LocomotionState == ELocomotionState::Ladder)
+	if (!TrySwapGun())
 	{
-		return;
+		BufferInput(ESoulBufferedAction::SwapGun);
+	}
+}
+
+bool ASoulCharacter::TrySwapGun()
+{
+	if (!CanPerform(ESoulCharacterAction::Swap))
+	{
+		return false;
 	}
 
 	if (IsAnimationBlockingActions())
 	{
-		return;
+		return false;
 	}
 
-	if (WeaponComp && WeaponComp->EquipWeapon(EWeaponType::Gun))
+	if (!WeaponComp || !WeaponComp->EquipWeapon(EWeaponType::Gun))
 	{
-		CurrentWeaponType = EWeaponType::Gun;
-		bIsAiming = false;
-		UpdateMovementSpeed();
+		return false;
 	}
+
+	ClearLockOn();
+
+	CurrentWeaponType = EWeaponType::Gun;
+	SetState(ESoulCharacterState::Aiming, false);
+	UpdateMovementSpeed();
+
+	return true;
 }
 
 void ASoulCharacter::SwapEmpty(const FInputActionValue& Value)
@@ -437,7 +539,7 @@ void ASoulCharacter::SwapEmpty(const FInputActionValue& Value)
 		return;
 	}
 
-	if (LocomotionState == ELocomotionState::Ladder)
+	if (!CanPerform(ESoulCharacterAction::Swap))
 	{
 		return;
 	}
@@ -454,6 +556,8 @@ void ASoulCharacter::SwapEmpty(const FInputActionValue& Value)
 		WeaponComp->EquipWeapon(EWeaponType::Empty);
 	}
 
+	ClearLockOn();
+
 	CurrentWeaponType = EWeaponType::Empty;
 	UpdateMovementSpeed();
 }
@@ -465,7 +569,7 @@ void ASoulCharacter::GunAimStart(const FInputActionValue& Value)
 		return;
 	}
 
-	if (LocomotionState == ELocomotionState::Ladder)
+	if (!CanPerform(ESoulCharacterAction::Aim))
 	{
 		return;
 	}
@@ -480,7 +584,12 @@ void ASoulCharacter::GunAimStart(const FInputActionValue& Value)
 		return;
 	}
 
-	bIsAiming = true;
+	if (StatComp && !StatComp->HasStamina())
+	{
+		return;
+	}
+
+	SetState(ESoulCharacterState::Aiming, true);
 
 	bUseControllerRotationYaw = true;
 	GetCharacterMovement()->bOrientRotationToMovement = false;
@@ -502,12 +611,12 @@ void ASoulCharacter::GunAimStop(const FInputActionValue& Value)
 
 void ASoulCharacter::StopAiming()
 {
-	if (!bIsAiming)
+	if (!HasState(ESoulCharacterState::Aiming))
 	{
 		return;
 	}
 
-	bIsAiming = false;
+	SetState(ESoulCharacterState::Aiming, false);
 
 	bUseControllerRotationYaw = false;
 	GetCharacterMovement()->bOrientRotationToMovement = true;
@@ -529,92 +638,52 @@ void ASoulCharacter::Attack(const FInputActionValue& Value)
 		return;
 	}
 
-	if (LocomotionState == ELocomotionState::Ladder)
+	if (!TryAttack(ESoulComboInput::Light))
 	{
-		return;
-	}
-
-	if (!IsGrounded())
-	{
-		return;
-	}
-
-	if (IsAnimationBlockingActions() && !bIsAttacking)
-	{
-		return;
-	}
-
-	switch (CurrentWeaponType)
-	{
-	case EWeaponType::Sword:
-		HandleSwordAttack();
-		break;
-
-	case EWeaponType::Gun:
-		HandleGunAttack();
-		break;
-
-	default:
-		break;
+		BufferInput(ESoulBufferedAction::LightAttack);
 	}
 }
 
-void ASoulCharacter::HandleSwordAttack()
+void ASoulCharacter::HeavyAttack(const FInputActionValue& Value)
 {
-	if (LocomotionState == ELocomotionState::Ladder)
+	if (!Value.Get<bool>())
 	{
 		return;
 	}
 
-	if (bIsAttacking)
+	if (!TryAttack(ESoulComboInput::Heavy))
 	{
-		if (!FMath::IsWithinInclusive<int32>(CurrentCombo, 1, MaxCombo))
-		{
-			return;
-		}
-		if (CanNextCombo)
-		{
-			IsComboInputOn = true;
-		}
-	}
-	else
-	{
-		if (CurrentCombo != 0)
-		{
-			return;
-		}
-		AttackStartComboState();
-		AnimInstance->PlaySwordAttackMontage();
-		AnimInstance->JumpToAttackMontageSection(CurrentCombo);
-		bIsAttacking = true;
+		BufferInput(ESoulBufferedAction::HeavyAttack);
 	}
 }
 
-void ASoulCharacter::HandleGunAttack()
+bool ASoulCharacter::HandleGunAttack()
 {
 	if (!bCanGunFire)
 	{
-		return;
+		return false;
 	}
 
-	if (!bIsAiming)
+	if (!HasState(ESoulCharacterState::Aiming))
 	{
-		return;
+		return false;
 	}
 
 	if (!AnimInstance)
 	{
-		return;
+		return false;
 	}
 
 	if (!IsGrounded())
 	{
-		return;
+		return false;
 	}
 
 	AnimInstance->PlayGunAttackMontage();
 
 	bCanGunFire = false;
+
+	return true;
 }
 
 void ASoulCharacter::DoGunShot()
@@ -624,35 +693,39 @@ void ASoulCharacter::DoGunShot()
 		return;
 	}
 
-	const FVector Start = FollowCamera->GetComponentLocation();
-	const FVector Direction = FollowCamera->GetForwardVector();
-	const FVector End = Start + Direction * GunRange;
+	FSoulCombatTelemetry::Record(ESoulCombatEvent::Shot, this, nullptr, GunDamage);
 
-	FHitResult HitResult;
-	FCollisionQueryParams Params(NAME_None, false, this);
-	FCollisionObjectQueryParams ObjectParams;
-	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
-	
-	const bool bHit = GetWorld()->LineTraceSingleByObjectType(HitResult, Start, End, ObjectParams, Params);
-
-#if ENABLE_DRAW_DEBUG
-	const FColor TraceColor = bHit ? FColor::Green : FColor::Red;
-	DrawDebugLine(GetWorld(), Start, End, TraceColor, false, 1, 0, 1);
-#endif
-
-	if (bHit)
+	const USoulWeaponData* GunData = WeaponComp ? WeaponComp->GetEquippedData() : nullptr;
+	if (GunData && GunData->FireMode == EGunFireMode::Projectile)
 	{
-		if (AActor* HitActor = HitResult.GetActor())
+		if (USoulProjectileSubsystem* Projectiles = GetWorld()->GetSubsystem<USoulProjectileSubsystem>())
 		{
-			if (HitActor->IsA<ACharacter>())
-			{
-				UGameplayStatics::ApplyPointDamage(HitActor, GunDamage, Direction, HitResult, GetController(), this, nullptr);
-
-				UE_LOG(LogTemp, Warning, TEXT("Gun hit actor: %s"), *HitActor->GetName());
-			}
+			const FVector Velocity = FollowCamera->GetForwardVector() * GunData->ProjectileSpeed;
+			Projectiles->SpawnProjectile(FollowCamera->GetComponentLocation(), Velocity, GunData->ProjectileGravityScale, GunData->ProjectileLifetime, GunDamage, this);
 		}
+
+		OnGunShotResolved(nullptr);
+		return;
+	}
+
+	USoulShotQueueSubsystem* ShotQueue = GetWorld()->GetSubsystem<USoulShotQueueSubsystem>();
+	if (!ShotQueue)
+	{
+		return;
 	}
 
+	FSoulShotRequest Request;
+	Request.Origin = FollowCamera->GetComponentLocation();
+	Request.Direction = FollowCamera->GetForwardVector();
+	Request.Range = GunRange;
+	Request.Damage = GunDamage;
+	Request.Instigator = this;
+
+	ShotQueue->QueueShot(Request);
+}
+
+void ASoulCharacter::OnGunShotResolved(const FHitResult* HitResult)
+{
 	if (APlayerController* PC = Cast<APlayerController>(GetController()))
 	{
 		if (auto SoulPC = Cast<ASoulPlayerController>(PC))
@@ -665,6 +738,8 @@ void ASoulCharacter::DoGunShot()
 void ASoulCharacter::OnGunCanReShot()
 {
 	bCanGunFire = true;
+
+	ConsumeBufferedInputs();
 }
 
 void ASoulCharacter::OnGunShotEnd()
@@ -678,111 +753,47 @@ void ASoulCharacter::OnGunShotEnd()
 	}
 }
 
-void ASoulCharacter::OnAttackMontageEnded(UAnimMontage* Montage, bool bInterrupted)
+void ASoulCharacter::Dodge(const FInputActionValue& Value)
 {
-	if (!bIsAttacking)
+	if (!Value.Get<bool>())
 	{
 		return;
 	}
 
-	if (CurrentCombo <= 0)
+	if (!TryDodge())
 	{
-		return;
+		BufferInput(ESoulBufferedAction::Dodge);
 	}
-
-	bIsAttacking = false;
-	AttackEndComboState();
-
-	OnAttackEnd.Broadcast();
 }
 
-void ASoulCharacter::AttackStartComboState()
+bool ASoulCharacter::TryDodge()
 {
-	CanNextCombo = true;
-	IsComboInputOn = false;
-	if (!FMath::IsWithinInclusive<int32>(CurrentCombo, 0, MaxCombo - 1))
+	if (!CanPerform(ESoulCharacterAction::Dodge))
 	{
-		return;
-	}
-	CurrentCombo = FMath::Clamp<int32>(CurrentCombo + 1, 1, MaxCombo);
-}
-
-void ASoulCharacter::AttackEndComboState()
-{
-	IsComboInputOn = false;
-	CanNextCombo = false;
-	CurrentCombo = 0;
-}
-
-void ASoulCharacter::AttackCheck()
-{
-	FHitResult HitResult;
-	FCollisionQueryParams Params(NAME_None, false, this);
-
-	bool bResult = GetWorld()->SweepSingleByChannel(HitResult, GetActorLocation(), GetActorLocation() + GetActorForwardVector() * SwordAttackRange, FQuat::Identity, ECollisionChannel::ECC_GameTraceChannel2, FCollisionShape::MakeSphere(SwordAttackRadius), Params);
-
-#if ENABLE_DRAW_DEBUG
-
-	FVector TraceVec = GetActorForwardVector() * SwordAttackRange;
-	FVector Center = GetActorLocation() + TraceVec * 0.5;
-	float HalfHeight = SwordAttackRange * 0.5 + SwordAttackRadius;
-	FQuat CapsuleRot = FRotationMatrix::MakeFromZ(TraceVec).ToQuat();
-	FColor DrawColor = bResult ? FColor::Green : FColor::Red;
-	float DebugLifeTime = 5;
-
-	DrawDebugCapsule(GetWorld(), Center, HalfHeight, SwordAttackRadius, CapsuleRot, DrawColor, false, DebugLifeTime);
-
-#endif
-
-	if (bResult)
-	{
-		AActor* HitActor = HitResult.GetActor();
-		if (HitActor)
-		{
-			UGameplayStatics::ApplyPointDamage(HitActor, SwordDamage, GetActorForwardVector(), HitResult, GetController(), this, nullptr);
-			UE_LOG(LogTemp, Warning, TEXT("Hit Actor Name : %s"), *HitActor->GetName());
-		}
-	}
-}
-
-void ASoulCharacter::Dodge(const FInputActionValue& Value)
-{
-	if (!Value.Get<bool>())
-	{
-		return;
+		return false;
 	}
 
 	if (IsAnimationBlockingActions())
 	{
-		return;
+		return false;
 	}
 
 	if (CurrentWeaponType == EWeaponType::Gun)
 	{
-		return;
-	}
-
-	if (bIsDodging)
-	{
-		return;
+		return false;
 	}
 
-	if (bIsAttacking)
-	{
-		return;
-	}
-
-	if (LocomotionState == ELocomotionState::Ladder)
+	if (!IsGrounded())
 	{
-		return;
+		return false;
 	}
 
-	if (!IsGrounded())
+	if (StatComp && !StatComp->ConsumeStamina(DodgeStaminaCost))
 	{
-		return;
+		return false;
 	}
 
-	bIsDodging = true;
+	SetState(ESoulCharacterState::Dodging, true);
 
 	UCharacterMovementComponent* MoveComp = GetCharacterMovement();
 	MoveComp->bOrientRotationToMovement = false;
@@ -807,84 +818,54 @@ void ASoulCharacter::Dodge(const FInputActionValue& Value)
 	{
 		AnimInstance->PlayDodgeMontage();
 	}
+
+	return true;
 }
 
 void ASoulCharacter::OnDodgeFinished()
 {
-	bIsDodging = false;
+	SetState(ESoulCharacterState::Dodging, false);
 
-	GetCharacterMovement()->bOrientRotationToMovement = true;
+	GetCharacterMovement()->bOrientRotationToMovement = !(LockOnComp && LockOnComp->IsLockedOn());
+
+	ConsumeBufferedInputs();
 }
 
 void ASoulCharacter::StartDodgeInvincible()
 {
-	bDodgeInvincible = true;
+	SetState(ESoulCharacterState::DodgeInvincible, true);
 }
 
 void ASoulCharacter::EndDodgeInvincible()
 {
-	bDodgeInvincible = false;
+	SetState(ESoulCharacterState::DodgeInvincible, false);
 }
 
 void ASoulCharacter::HandleDead()
 {
-	if (bIsDead)
+	if (HasState(ESoulCharacterState::Dead))
 	{
 		return;
 	}
 
-	bIsDead = true;
+	Super::HandleDead();
 
-	GetCharacterMovement()->DisableMovement();
+	ClearLockOn();
+	InputBuffer.Reset();
 
-	bIsAttacking = false;
-	bIsSprinting = false;
-	bIsAiming = false;
+	SetState(ESoulCharacterState::Sprinting, false);
+	SetState(ESoulCharacterState::Aiming, false);
 	UpdateMovementSpeed();
-
-	SetActorEnableCollision(false);
 }
 
-void ASoulCharacter::OnHitDamage()
-{
-	if (bIsDead)
-	{
-		return;
-	}
-
-	if (AnimInstance)
-	{
-		AnimInstance->PlayHitReactMontage();
-	}
-
-	bIsHit = true;
-
-	GetWorldTimerManager().SetTimer(HitRecoveryTimer, [this]() {
-		bIsHit = false;
-		}, 0.3, false);
-}
-
-void ASoulCharacter::SpawnDamageText(AActor* DamagedActor, float Damage)
+void ASoulCharacter::Interact(const FInputActionValue& Value)
 {
-	if (!DamageTextActorClass || !DamagedActor)
+	if (!Value.Get<bool>())
 	{
 		return;
 	}
 
-	FVector TargetLocation = DamagedActor->GetActorLocation() + FVector(0, 0, 100);
-	FActorSpawnParameters Params;
-	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-	AFloatingDamageActor* DamageText = GetWorld()->SpawnActor<AFloatingDamageActor>(DamageTextActorClass, TargetLocation, FRotator::ZeroRotator, Params);
-	if (DamageText)
-	{
-		DamageText->SetDamage(Damage);
-	}
-}
-
-void ASoulCharacter::Interact(const FInputActionValue& Value)
-{
-	if (!Value.Get<bool>())
+	if (!CanPerform(ESoulCharacterAction::Interact))
 	{
 		return;
 	}
@@ -964,7 +945,7 @@ void ASoulCharacter::StartAutoFace(const AActor* Target)
 	}
 
 	AutoFaceTarget = Target;
-	bAutoFacing = true;
+	SetState(ESoulCharacterState::AutoFacing, true);
 
 	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
 	{
@@ -980,7 +961,7 @@ void ASoulCharacter::StartAutoFace(const AActor* Target)
 
 void ASoulCharacter::StopAutoFace()
 {
-	bAutoFacing = false;
+	SetState(ESoulCharacterState::AutoFacing, false);
 	AutoFaceTarget = nullptr;
 
 	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
@@ -1000,13 +981,20 @@ void ASoulCharacter::UpdateAutoFace(float DeltaSeconds)
 		return;
 	}
 
-	FVector ToTarget = AutoFaceTarget->GetActorLocation() - GetActorLocation();
+	if (InterpFaceLocation(AutoFaceTarget->GetActorLocation(), DeltaSeconds))
+	{
+		StopAutoFace();
+	}
+}
+
+bool ASoulCharacter::InterpFaceLocation(const FVector& TargetLocation, float DeltaSeconds)
+{
+	FVector ToTarget = TargetLocation - GetActorLocation();
 	ToTarget.Z = 0;
 
 	if (ToTarget.IsNearlyZero())
 	{
-		StopAutoFace();
-		return;
+		return true;
 	}
 
 	const FRotator CurrentRot = GetActorRotation();
@@ -1019,11 +1007,86 @@ void ASoulCharacter::UpdateAutoFace(float DeltaSeconds)
 	{
 		NewRot.Yaw = TargetRot.Yaw;
 		SetActorRotation(NewRot);
-		StopAutoFace();
-		return;
+		return true;
 	}
 
 	SetActorRotation(NewRot);
+	return false;
+}
+
+void ASoulCharacter::ToggleLockOn(const FInputActionValue& Value)
+{
+	if (!LockOnComp)
+	{
+		return;
+	}
+
+	if (LockOnComp->IsLockedOn())
+	{
+		ClearLockOn();
+		return;
+	}
+
+	if (CurrentWeaponType != EWeaponType::Sword || !CanPerform(ESoulCharacterAction::LockOn))
+	{
+		return;
+	}
+
+	LockOnComp->ToggleLockOn();
+}
+
+void ASoulCharacter::SwitchLockOnTarget(const FInputActionValue& Value)
+{
+	if (!LockOnComp)
+	{
+		return;
+	}
+
+	const float Axis = Value.Get<float>();
+	LockOnComp->SwitchTarget(Axis < 0 ? -1 : 1);
+}
+
+void ASoulCharacter::OnLockOnTargetChanged(ACharacter* NewTarget)
+{
+	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	{
+		if (!IsOnLadder() && !HasState(ESoulCharacterState::Dodging))
+		{
+			MoveComp->bOrientRotationToMovement = (NewTarget == nullptr);
+		}
+	}
+}
+
+void ASoulCharacter::UpdateLockOn(float DeltaSeconds)
+{
+	const ACharacter* Target = LockOnComp->GetLockedTarget();
+	if (!Target)
+	{
+		return;
+	}
+
+	if (!HasState(ESoulCharacterState::Dodging))
+	{
+		InterpFaceLocation(Target->GetActorLocation(), DeltaSeconds);
+	}
+
+	if (AController* PlayerController = GetController())
+	{
+		FRotator LookRot = (Target->GetActorLocation() - GetActorLocation()).Rotation();
+		LookRot.Pitch = LockOnCameraPitch;
+		LookRot.Roll = 0;
+
+		PlayerController->SetControlRotation(FMath::RInterpTo(PlayerController->GetControlRotation(), LookRot, DeltaSeconds, LockOnCameraInterpSpeed));
+	}
+}
+
+void ASoulCharacter::ClearLockOn()
+{
+	// Not gated on IsLockedOn(): a destroyed target leaves the component ticking and ready to re-acquire.
+	if (LockOnComp)
+	{
+		LockOnComp->ClearLockOn();
+	}
 }
 
 void ASoulCharacter::PlayOpenBoxAnim()
@@ -1073,18 +1136,19 @@ void ASoulCharacter::BeginLadder(ASoulLadderActor* Ladder)
 		return;
 	}
 
-	if (LocomotionState != ELocomotionState::Normal)
+	if (IsOnLadder())
 	{
 		return;
 	}
 
 	StopAiming();
-	bIsSprinting = false;
+	ClearLockOn();
+	SetState(ESoulCharacterState::Sprinting, false);
 	UpdateMovementSpeed();
 
 	CurrentLadder = Ladder;
 	LadderInput = 0;
-	bLadderMounting = true;
+	SetState(ESoulCharacterState::LadderMounting, true);
 
 	FaceToActor(Ladder);
 
@@ -1093,29 +1157,20 @@ void ASoulCharacter::BeginLadder(ASoulLadderActor* Ladder)
 		{
 			if (!CurrentLadder.IsValid())
 			{
-				bLadderMounting = false;
+				SetState(ESoulCharacterState::LadderMounting, false);
 				return;
 			}
 
 			if (CurrentLadder->GetLastUseSide() == ELadderUseSide::Top)
 			{
-				bLadderMounting = true;
-				bTopMountMoving = true;
-
-				TopMountMoveElapsed = 0;
-				TopMountStartLoc = GetActorLocation();
-				TopMountStartRot = GetActorRotation();
-
-				TopMountTargetLoc = CurrentLadder->GetTopMountStartLocation();
-				TopMountTargetRot = CurrentLadder->GetTopMountStartRotation();
+				SetState(ESoulCharacterState::LadderMounting, true);
+				SetState(ESoulCharacterState::TopMountMoving, true);
 
-				if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+				if (USoulCharacterMovementComponent* MoveComp = GetSoulMovement())
 				{
-					MoveComp->StopMovementImmediately();
-					MoveComp->SetMovementMode(MOVE_Flying);
-					MoveComp->Velocity = FVector::ZeroVector;
 					MoveComp->bOrientRotationToMovement = false;
 					MoveComp->bUseControllerDesiredRotation = false;
+					MoveComp->BeginLadderMount(CurrentLadder->GetTopMountStartLocation(), CurrentLadder->GetTopMountStartRotation(), TopMountMoveTime);
 				}
 
 				bUseControllerRotationYaw = false;
@@ -1123,22 +1178,15 @@ void ASoulCharacter::BeginLadder(ASoulLadderActor* Ladder)
 				return;
 			}
 
-			FVector SnapLoc;
-			FRotator SnapRot;
-			CurrentLadder->GetSnapTransform(this, SnapLoc, SnapRot);
-
-			SetActorLocation(SnapLoc);
-			SetActorRotation(SnapRot);
-
 			EnterLadderMode();
 
-			bLadderMounting = false;
+			SetState(ESoulCharacterState::LadderMounting, false);
 		});
 }
 
 void ASoulCharacter::EndLadder()
 {
-	if (LocomotionState != ELocomotionState::Ladder)
+	if (!IsOnLadder())
 	{
 		return;
 	}
@@ -1147,21 +1195,22 @@ void ASoulCharacter::EndLadder()
 
 	CurrentLadder = nullptr;
 	LadderInput = 0;
-	bLadderMounting = false;
+	SetState(ESoulCharacterState::LadderMounting, false);
 }
 
 void ASoulCharacter::EnterLadderMode()
 {
-	LocomotionState = ELocomotionState::Ladder;
+	SetState(ESoulCharacterState::OnLadder, true);
 
-	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	if (USoulCharacterMovementComponent* MoveComp = GetSoulMovement())
 	{
-		MoveComp->StopMovementImmediately();
-		MoveComp->SetMovementMode(MOVE_Flying);
-		MoveComp->Velocity = FVector::ZeroVector;
-
 		MoveComp->bOrientRotationToMovement = false;
 		MoveComp->bUseControllerDesiredRotation = false;
+
+		if (CurrentLadder.IsValid())
+		{
+			MoveComp->EnterLadder(CurrentLadder.Get());
+		}
 	}
 
 	bUseControllerRotationYaw = false;
@@ -1169,11 +1218,11 @@ void ASoulCharacter::EnterLadderMode()
 
 void ASoulCharacter::ExitLadderMode()
 {
-	LocomotionState = ELocomotionState::Normal;
+	SetState(ESoulCharacterState::OnLadder, false);
 
-	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	if (USoulCharacterMovementComponent* MoveComp = GetSoulMovement())
 	{
-		MoveComp->SetMovementMode(MOVE_Walking);
+		MoveComp->ExitLadder();
 		MoveComp->bOrientRotationToMovement = true;
 		MoveComp->bUseControllerDesiredRotation = true;
 	}
@@ -1187,45 +1236,21 @@ void ASoulCharacter::UpdateLadder(float DeltaSeconds)
 		return;
 	}
 
-	if (bLadderMounting)
+	if (HasState(ESoulCharacterState::LadderMounting))
 	{
-		if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
-		{
-			MoveComp->Velocity = FVector::ZeroVector;
-		}
-
 		return;
 	}
 
-	FVector SnapLoc;
-	FRotator SnapRot;
-	CurrentLadder->GetSnapTransform(this, SnapLoc, SnapRot);
-
-	float MinZ, MaxZ;
-	CurrentLadder->GetClimbZRange(MinZ, MaxZ);
-
-	FVector NewLoc = GetActorLocation();
-
-	NewLoc.X = SnapLoc.X;
-	NewLoc.Y = SnapLoc.Y;
-
-	NewLoc.Z += LadderInput * LadderMoveSpeed * DeltaSeconds;
-	NewLoc.Z = FMath::Clamp(NewLoc.Z, MinZ, MaxZ);
-
-	const FRotator NewRot = FMath::RInterpTo(GetActorRotation(), SnapRot, DeltaSeconds, LadderAlignInterpSpeed);
-
-	SetActorLocation(NewLoc);
-	SetActorRotation(NewRot);
-
-	constexpr float EndEpsilon = 1;
-
-	const bool bAtTop = FMath::Abs(NewLoc.Z - MaxZ) <= EndEpsilon;
-	const bool bAtBottom = FMath::Abs(NewLoc.Z - MinZ) <= EndEpsilon;
+	const USoulCharacterMovementComponent* MoveComp = GetSoulMovement();
+	if (!MoveComp)
+	{
+		return;
+	}
 
-	if (bAtTop && LadderInput > 0)
+	if (LadderInput > 0 && MoveComp->IsAtLadderTop())
 	{
 		LadderInput = 0;
-		bLadderMounting = true;
+		SetState(ESoulCharacterState::LadderMounting, true);
 
 		if (AnimInstance)
         {
@@ -1234,23 +1259,17 @@ void ASoulCharacter::UpdateLadder(float DeltaSeconds)
 		return;
 	}
 
-	if (bAtBottom && LadderInput < 0)
+	if (LadderInput < 0 && MoveComp->IsAtLadderBottom())
 	{
 		const FVector ExitLoc = CurrentLadder->GetBottomExitLocation();
 		EndLadder();
 		SetActorLocation(ExitLoc, false, nullptr, ETeleportType::TeleportPhysics);
-		return;
-	}
-
-	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
-	{
-		MoveComp->Velocity = FVector::ZeroVector;
 	}
 }
 
 void ASoulCharacter::MoveCompleted(const FInputActionValue& Value)
 {
-	if (LocomotionState == ELocomotionState::Ladder)
+	if (IsOnLadder())
 	{
 		LadderInput = 0;
 	}
@@ -1260,31 +1279,20 @@ void ASoulCharacter::UpdateTopMountMove(float DeltaSeconds)
 {
 	if (!CurrentLadder.IsValid())
 	{
-		bTopMountMoving = false;
-		bLadderMounting = false;
-		return;
-	}
-
-	TopMountMoveElapsed += DeltaSeconds;
-	const float SafeDuration = FMath::Max(TopMountMoveTime, KINDA_SMALL_NUMBER);
-	const float Alpha = FMath::Clamp(TopMountMoveElapsed / SafeDuration, 0, 1);
-
-	const FVector NewLoc = FMath::Lerp(TopMountStartLoc, TopMountTargetLoc, Alpha);
-	const FRotator NewRot = FMath::Lerp(TopMountStartRot, TopMountTargetRot, Alpha);
-
-	SetActorLocation(NewLoc, false, nullptr, ETeleportType::TeleportPhysics);
-	SetActorRotation(NewRot);
+		SetState(ESoulCharacterState::TopMountMoving, false);
+		SetState(ESoulCharacterState::LadderMounting, false);
 
-	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
-	{
-		MoveComp->StopMovementImmediately();
-		MoveComp->SetMovementMode(MOVE_Flying);
-		MoveComp->Velocity = FVector::ZeroVector;
+		if (USoulCharacterMovementComponent* MoveComp = GetSoulMovement())
+		{
+			MoveComp->ExitLadder();
+		}
+		return;
 	}
 
-	if (Alpha >= 1)
+	const USoulCharacterMovementComponent* MoveComp = GetSoulMovement();
+	if (!MoveComp || MoveComp->IsLadderMountFinished())
 	{
-		bTopMountMoving = false;
+		SetState(ESoulCharacterState::TopMountMoving, false);
 
 		if (AnimInstance)
 		{
@@ -1310,7 +1318,7 @@ void ASoulCharacter::GiveGunFromBox(bool bAutoEquip)
 	if (bAutoEquip)
 	{
 		StopAiming();
-		bIsSprinting = false;
+		SetState(ESoulCharacterState::Sprinting, false);
 
 		WeaponComp->EquipWeapon(EWeaponType::Gun);
 		CurrentWeaponType = EWeaponType::Gun;
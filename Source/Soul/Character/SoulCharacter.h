@@ -1,21 +1,20 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "GameFramework/Character.h"
+#include "SoulCombatCharacterBase.h"
 #include "InputActionValue.h"
-#include "../Common/WeaponTypes.h"
+#include "SoulInputBuffer.h"
 #include "SoulCharacter.generated.h"
 
 class UInputAction;
 class UInputMappingContext;
 class USpringArmComponent;
 class UCameraComponent;
-class USoulCharacterStatComponent;
 class ASoulLadderActor;
-class USoulWeaponComponent;
-class USoulWeaponData;
+class USoulLockOnComponent;
+class USoulCameraRigComponent;
+class USoulCharacterMovementComponent;
 
-DECLARE_MULTICAST_DELEGATE(FOnAttackEndDelegate);
 DECLARE_MULTICAST_DELEGATE(FOnAutoFaceEndDelegate);
 
 UENUM(BlueprintType)
@@ -26,22 +25,18 @@ enum class ELocomotionState : uint8
 };
 
 UCLASS()
-class SOUL_API ASoulCharacter : public ACharacter
+class SOUL_API ASoulCharacter : public ASoulCombatCharacterBase
 {
 	GENERATED_BODY()
 
 public:
-	ASoulCharacter();
-
-	FORCEINLINE bool GetIsSprinting() const { return bIsSprinting; }
-	FORCEINLINE bool GetIsAttacking() const { return bIsAttacking; }
-	FORCEINLINE EWeaponType GetCurrentWeaponType() const { return CurrentWeaponType; }
-	FORCEINLINE bool GetIsAiming() const { return bIsAiming; }
-	FORCEINLINE bool GetIsDead() const { return bIsDead; }
-	FORCEINLINE bool GetIsHit() const { return bIsHit; }
-	FORCEINLINE bool IsOnLadder() const { return LocomotionState == ELocomotionState::Ladder; }
+	ASoulCharacter(const FObjectInitializer& ObjectInitializer);
+
+	FORCEINLINE ELocomotionState GetLocomotionState() const { return IsOnLadder() ? ELocomotionState::Ladder : ELocomotionState::Normal; }
 	FORCEINLINE float GetLadderInput() const { return LadderInput; }
 
+	USoulCharacterMovementComponent* GetSoulMovement() const;
+
 	void SetInteractTarget(AActor* NewTarget);
 	void ClearInteractTarget(AActor* Target);
 
@@ -57,57 +52,72 @@ public:
 
 	void GiveGunFromBox(bool bAutoEquip = false);
 
+	void OnGunShotResolved(const FHitResult* HitResult);
+
+	virtual void HandleAnimEvent(ESoulAnimEvent Event) override;
+
 protected:
+	virtual void OnStateBitsChanged(uint16 OldBits, uint16 NewBits) override;
+	virtual void OnActionWindowOpened() override;
+
+	void BufferInput(ESoulBufferedAction Action);
+	void ConsumeBufferedInputs();
+	bool ExecuteBufferedAction(ESoulBufferedAction Action);
+	float GetInputBufferWindow(ESoulBufferedAction Action) const;
+
 	virtual void BeginPlay() override;
 	virtual void PostInitializeComponents() override;
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 	virtual void Tick(float DeltaSeconds) override;
-	virtual float TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser) override;
-	virtual void Reset() override;
 
 	void Move(const FInputActionValue& Value);
 	void Look(const FInputActionValue& Value);
 	void SprintStart(const FInputActionValue& Value);
 	void SprintStop(const FInputActionValue& Value);
-	bool IsGrounded() const;
 	void Attack(const FInputActionValue& Value);
+	void HeavyAttack(const FInputActionValue& Value);
 	void SwapSword(const FInputActionValue& Value);
 	void SwapGun(const FInputActionValue& Value);
+	bool TrySwapGun();
 	void SwapEmpty(const FInputActionValue& Value);
 	void GunAimStart(const FInputActionValue& Value);
 	void GunAimStop(const FInputActionValue& Value);
 	void StopAiming();
-	void HandleSwordAttack();
-	void HandleGunAttack();
+	virtual bool HandleGunAttack() override;
 	void DoGunShot();
 	void OnGunCanReShot();
 	void OnGunShotEnd();
 	void UpdateMovementSpeed();
-	bool IsAnimationBlockingActions() const;
+	void UpdateStaminaDrain();
 
 	UFUNCTION()
-	void OnAttackMontageEnded(UAnimMontage* Montage, bool bInterrupted);
-
-	void AttackStartComboState();
-	void AttackEndComboState();
-	void AttackCheck();
+	void OnStaminaExhausted();
 
 	void Dodge(const FInputActionValue& Value);
+	bool TryDodge();
 	void StartDodgeInvincible();
 	void EndDodgeInvincible();
 	void OnDodgeFinished();
 
-	UFUNCTION()
-	void HandleDead();
+	void OnLadderTopMountEnd();
+	void OnLadderTopExitEnd();
 
-	void OnHitDamage();
+	using FAnimEventHandler = void (ASoulCharacter::*)();
+	static const FAnimEventHandler AnimEventHandlers[];
 
-	void SpawnDamageText(AActor* DamagedActor, float Damage);
+	virtual void HandleDead() override;
 
 	void Interact(const FInputActionValue& Value);
 
 	void StartAutoFace(const AActor* Target);
 	void UpdateAutoFace(float DeltaSeconds);
+	bool InterpFaceLocation(const FVector& TargetLocation, float DeltaSeconds);
+
+	void ToggleLockOn(const FInputActionValue& Value);
+	void SwitchLockOnTarget(const FInputActionValue& Value);
+	void OnLockOnTargetChanged(ACharacter* NewTarget);
+	void UpdateLockOn(float DeltaSeconds);
+	void ClearLockOn();
 	void StopAutoFace();
 
 	void EnterLadderMode();
@@ -122,8 +132,6 @@ public:
 	FOnAutoFaceEndDelegate OnAutoFaceEnd;
 
 protected:
-	FOnAttackEndDelegate OnAttackEnd;
-
 	UPROPERTY(EditAnywhere,Category="Input")
 	TObjectPtr<UInputAction> MoveAction;
 
@@ -136,6 +144,9 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Input")
 	TObjectPtr<UInputAction> AttackAction;
 
+	UPROPERTY(EditAnywhere, Category = "Input")
+	TObjectPtr<UInputAction> HeavyAttackAction;
+
 	UPROPERTY(EditAnywhere, Category = "Input")
 	TObjectPtr<UInputAction> SwapSwordAction;
 
@@ -154,6 +165,12 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Input")
 	TObjectPtr<UInputAction> InteractAction;
 
+	UPROPERTY(EditAnywhere, Category = "Input")
+	TObjectPtr<UInputAction> LockOnAction;
+
+	UPROPERTY(EditAnywhere, Category = "Input")
+	TObjectPtr<UInputAction> SwitchLockOnTargetAction;
+
 	UPROPERTY(EditAnywhere, Category = "Input")
 	TObjectPtr<UInputMappingContext> DefaultMappingContext;
 
@@ -163,6 +180,9 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<UCameraComponent> FollowCamera;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<USoulCameraRigComponent> CameraRig;
+
 	UPROPERTY(EditAnywhere, Category = "Movement")
 	float EmptyWalkSpeed = 400;
 
@@ -181,103 +201,40 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Movement")
 	float GunAimWalkSpeed = 50;
 
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Movement", meta = (AllowPrivateAccess = "true"))
-	bool bIsSprinting = false;
-
-	UPROPERTY()
-	TObjectPtr<class USoulAnimInstance> AnimInstance;
-
-	UPROPERTY(VisibleInstanceOnly, Category = "Weapon")
-	bool bIsAttacking;
-
-	UPROPERTY(VisibleInstanceOnly, Category = "Weapon")
-	bool CanNextCombo;
-
-	UPROPERTY(VisibleInstanceOnly, Category = "Weapon")
-	bool IsComboInputOn;
-
-	UPROPERTY(VisibleInstanceOnly, Category = "Weapon")
-	int32 CurrentCombo;
-
-	UPROPERTY(VisibleInstanceOnly, Category = "Weapon")
-	int32 MaxCombo = 4;
-
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Weapon")
-	EWeaponType CurrentWeaponType = EWeaponType::Empty;
-
 	UPROPERTY(VisibleInstanceOnly, Category = "Weapon")
 	bool bCanGunFire = true;
 
-	UPROPERTY(VisibleInstanceOnly, Category = "Weapon")
-	bool bIsAiming = false;
-
-	UPROPERTY(VisibleInstanceOnly, Category = "Camera")
-	float DefaultFOV = 90;
-
-	UPROPERTY(VisibleInstanceOnly, Category = "Camera")
-	float AimFOV = 70;
-
-	UPROPERTY(VisibleInstanceOnly, Category = "Camera")
-	float FOVInterpSpeed = 20;
-
-	UPROPERTY(VisibleInstanceOnly, Category = "Camera")
-	float DefaultArmLength = 400;
-
-	UPROPERTY(EditAnywhere, Category = "Camera")
-	float AimArmLength = 150;
-
-	UPROPERTY(VisibleInstanceOnly, Category = "Camera")
-	FVector DefaultSocketOffset = FVector::ZeroVector;
-
-	UPROPERTY(EditAnywhere, Category = "Camera")
-	FVector AimSocketOffset = FVector(0, 50, 40);
-
-	UPROPERTY(EditAnywhere, Category = "Camera")
-	float CameraInterpSpeed = 10;
-
-	UPROPERTY(VisibleInstanceOnly, Category = "Weapon")
-	float SwordAttackRange = 130;
-
-	UPROPERTY(VisibleInstanceOnly, Category = "Weapon")
-	float SwordAttackRadius = 50;
-
-	UPROPERTY(EditAnywhere, Category = "Weapon|Sword")
-	float SwordDamage = 20;
-
 	UPROPERTY(EditAnywhere, Category = "Weapon|Gun")
 	float GunDamage = 15;
 
 	UPROPERTY(EditAnywhere, Category = "Weapon|Gun")
 	float GunRange = 2000;
 
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Movement", meta = (AllowPrivateAccess = "true"))
-	bool bIsDodging = false;
-
 	UPROPERTY(EditAnywhere, Category = "Movement")
 	float DodgeStrength = 400;
 
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Movement", meta = (AllowPrivateAccess = "true"))
-	bool bDodgeInvincible = false;
+	UPROPERTY(EditAnywhere, Category = "Stamina", meta = (ClampMin = "0"))
+	float SprintStaminaPerSecond = 15;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
-	TObjectPtr<USoulCharacterStatComponent> StatComp;
+	UPROPERTY(EditAnywhere, Category = "Stamina", meta = (ClampMin = "0"))
+	float AimStaminaPerSecond = 5;
 
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Movement", meta = (AllowPrivateAccess = "true"))
-	bool bIsDead = false;
+	UPROPERTY(EditAnywhere, Category = "Stamina", meta = (ClampMin = "0"))
+	float DodgeStaminaCost = 25;
 
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Movement", meta = (AllowPrivateAccess = "true"))
-	bool bIsHit = false;
+	UPROPERTY(EditAnywhere, Category = "Input|Buffer", meta = (ClampMin = "0"))
+	float AttackInputBufferWindow = 0.35;
 
-	FTimerHandle HitRecoveryTimer;
+	UPROPERTY(EditAnywhere, Category = "Input|Buffer", meta = (ClampMin = "0"))
+	float DodgeInputBufferWindow = 0.25;
 
-	UPROPERTY(EditDefaultsOnly, Category = "UI")
-	TSubclassOf<class AFloatingDamageActor> DamageTextActorClass;
+	UPROPERTY(EditAnywhere, Category = "Input|Buffer", meta = (ClampMin = "0"))
+	float SwapInputBufferWindow = 0.2;
 
-	UPROPERTY(VisibleInstanceOnly, Category = "Interact")
-	TWeakObjectPtr<AActor> CurrentInteractTarget;
+	FSoulInputBuffer InputBuffer;
 
 	UPROPERTY(VisibleInstanceOnly, Category = "Interact")
-	bool bAutoFacing = false;
+	TWeakObjectPtr<AActor> CurrentInteractTarget;
 
 	UPROPERTY()
 	TWeakObjectPtr<const AActor> AutoFaceTarget;
@@ -291,45 +248,23 @@ protected:
 	bool bPrevOrientToMove = false;
 	bool bPrevUseControllerDesired = false;
 
-	UPROPERTY(VisibleInstanceOnly, Category = "Movement")
-	ELocomotionState LocomotionState = ELocomotionState::Normal;
-
 	UPROPERTY()
 	TWeakObjectPtr<ASoulLadderActor> CurrentLadder;
 
 	UPROPERTY(VisibleInstanceOnly, Category = "Ladder")
 	float LadderInput = 0;
 
-	UPROPERTY(EditDefaultsOnly, Category = "Ladder")
-	float LadderMoveSpeed = 90;
-
-	UPROPERTY(EditDefaultsOnly, Category = "Ladder")
-	float LadderAlignInterpSpeed = 12;
-
-	UPROPERTY(VisibleInstanceOnly, Category = "Ladder")
-	bool bLadderMounting = false;
-
-	UPROPERTY(VisibleInstanceOnly, Category = "Ladder")
-	bool bTopMountMoving = false;
-
-	UPROPERTY(VisibleInstanceOnly, Category = "Ladder")
-	FVector TopMountTargetLoc;
-
-	UPROPERTY(VisibleInstanceOnly, Category = "Ladder")
-	FRotator TopMountTargetRot;
-
 	UPROPERTY(EditDefaultsOnly, Category = "Ladder")
 	float TopMountMoveTime = 1;
 
-	float TopMountMoveElapsed = 0;
-	FVector TopMountStartLoc;
-	FRotator TopMountStartRot;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LockOn", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<USoulLockOnComponent> LockOnComp;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Weapon", meta = (AllowPrivateAccess = "true"))
-	TObjectPtr<USoulWeaponComponent> WeaponComp;
+	UPROPERTY(EditAnywhere, Category = "LockOn")
+	float LockOnCameraInterpSpeed = 8;
 
-	UPROPERTY(EditDefaultsOnly, Category = "Weapon")
-	TObjectPtr<USoulWeaponData> DefaultSwordData;
+	UPROPERTY(EditAnywhere, Category = "LockOn")
+	float LockOnCameraPitch = -15;
 
 	UPROPERTY(EditDefaultsOnly, Category = "Weapon")
 	TObjectPtr<class USoulWeaponData> DefaultGunData;
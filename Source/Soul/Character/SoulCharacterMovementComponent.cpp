@@ -0,0 +1,141 @@
+#include "SoulCharacterMovementComponent.h"
+#include "../Interact/SoulLadderActor.h"
+
+#include "GameFramework/Character.h"
+
+void USoulCharacterMovementComponent::EnterLadder(const ASoulLadderActor* Ladder)
+{
+	if (!Ladder || !Ladder->GetRail().IsValid())
+	{
+		return;
+	}
+
+	ClimbingLadder = Ladder;
+	LadderDistance = Ladder->GetRail().FindNearestDistance(UpdatedComponent->GetComponentLocation());
+
+	StopMovementImmediately();
+	SetMovementMode(MOVE_Custom, CMOVE_Ladder);
+}
+
+void USoulCharacterMovementComponent::ExitLadder()
+{
+	if (MovementMode != MOVE_Custom)
+	{
+		return;
+	}
+
+	ClimbingLadder = nullptr;
+	SetMovementMode(MOVE_Walking);
+}
+
+void USoulCharacterMovementComponent::BeginLadderMount(const FVector& TargetLocation, const FRotator& TargetRotation, float Duration)
+{
+	LadderMountStartLocation = UpdatedComponent->GetComponentLocation();
+	LadderMountStartRotation = UpdatedComponent->GetComponentRotation();
+	LadderMountTargetLocation = TargetLocation;
+	LadderMountTargetRotation = TargetRotation;
+	LadderMountDuration = FMath::Max(Duration, KINDA_SMALL_NUMBER);
+	LadderMountElapsed = 0;
+
+	StopMovementImmediately();
+	SetMovementMode(MOVE_Custom, CMOVE_LadderMount);
+}
+
+bool USoulCharacterMovementComponent::IsAtLadderTop() const
+{
+	return IsInCustomMode(CMOVE_Ladder) && ClimbingLadder.IsValid() && LadderDistance >= ClimbingLadder->GetRail().Length - LadderEndTolerance;
+}
+
+bool USoulCharacterMovementComponent::IsAtLadderBottom() const
+{
+	return IsInCustomMode(CMOVE_Ladder) && ClimbingLadder.IsValid() && LadderDistance <= LadderEndTolerance;
+}
+
+float USoulCharacterMovementComponent::GetMaxSpeed() const
+{
+	if (IsInCustomMode(CMOVE_Ladder))
+	{
+		return LadderClimbSpeed;
+	}
+
+	return Super::GetMaxSpeed();
+}
+
+void USoulCharacterMovementComponent::PhysCustom(float DeltaTime, int32 Iterations)
+{
+	Super::PhysCustom(DeltaTime, Iterations);
+
+	switch (CustomMovementMode)
+	{
+	case CMOVE_Ladder:
+		PhysLadder(DeltaTime, Iterations);
+		break;
+
+	case CMOVE_LadderMount:
+		PhysLadderMount(DeltaTime, Iterations);
+		break;
+
+	default:
+		break;
+	}
+}
+
+void USoulCharacterMovementComponent::PhysLadder(float DeltaTime, int32 Iterations)
+{
+	if (DeltaTime < MIN_TICK_TIME)
+	{
+		return;
+	}
+
+	if (!ClimbingLadder.IsValid())
+	{
+		SetMovementMode(MOVE_Falling);
+		return;
+	}
+
+	const FSoulLadderRail& Rail = ClimbingLadder->GetRail();
+
+	const float ClimbInput = FMath::Clamp<float>(Acceleration.Z / FMath::Max<float>(GetMaxAcceleration(), 1), -1, 1);
+	LadderDistance = FMath::Clamp<float>(LadderDistance + ClimbInput * LadderClimbSpeed * DeltaTime, 0, Rail.Length);
+
+	FVector TargetLocation;
+	FRotator TargetFacing;
+	Rail.Sample(LadderDistance, TargetLocation, TargetFacing);
+
+	const FVector Delta = TargetLocation - UpdatedComponent->GetComponentLocation();
+	const FQuat NewRotation = FMath::RInterpTo(UpdatedComponent->GetComponentRotation(), TargetFacing, DeltaTime, LadderAlignInterpSpeed).Quaternion();
+
+	Velocity = Delta / DeltaTime;
+
+	if (Delta.IsNearlyZero() && NewRotation.Equals(UpdatedComponent->GetComponentQuat()))
+	{
+		return;
+	}
+
+	FHitResult Hit(1);
+	SafeMoveUpdatedComponent(Delta, NewRotation, true, Hit);
+
+	if (Hit.IsValidBlockingHit())
+	{
+		SlideAlongSurface(Delta, 1 - Hit.Time, Hit.Normal, Hit, true);
+		LadderDistance = Rail.FindNearestDistance(UpdatedComponent->GetComponentLocation());
+	}
+}
+
+void USoulCharacterMovementComponent::PhysLadderMount(float DeltaTime, int32 Iterations)
+{
+	Velocity = FVector::ZeroVector;
+
+	if (IsLadderMountFinished())
+	{
+		return;
+	}
+
+	LadderMountElapsed = FMath::Min(LadderMountElapsed + DeltaTime, LadderMountDuration);
+	const float Alpha = LadderMountElapsed / LadderMountDuration;
+
+	const FVector NewLocation = FMath::Lerp(LadderMountStartLocation, LadderMountTargetLocation, Alpha);
+	const FRotator NewRotation = FMath::Lerp(LadderMountStartRotation, LadderMountTargetRotation, Alpha);
+
+	MoveUpdatedComponent(NewLocation - UpdatedComponent->GetComponentLocation(), NewRotation, false, nullptr, ETeleportType::TeleportPhysics);
+}
\ No newline at end of file
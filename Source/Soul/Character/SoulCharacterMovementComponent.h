@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "SoulCharacterMovementComponent.generated.h"
+
+class ASoulLadderActor;
+
+UENUM(BlueprintType)
+enum ESoulCustomMovementMode : uint8
+{
+	CMOVE_None        UMETA(Hidden),
+	CMOVE_Ladder      UMETA(DisplayName = "Ladder"),
+	CMOVE_LadderMount UMETA(DisplayName = "Ladder Mount"),
+};
+
+UCLASS()
+class SOUL_API USoulCharacterMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	void EnterLadder(const ASoulLadderActor* Ladder);
+	void ExitLadder();
+
+	void BeginLadderMount(const FVector& TargetLocation, const FRotator& TargetRotation, float Duration);
+
+	FORCEINLINE bool IsInCustomMode(ESoulCustomMovementMode Mode) const { return MovementMode == MOVE_Custom && CustomMovementMode == Mode; }
+	FORCEINLINE bool IsLadderMountFinished() const { return LadderMountElapsed >= LadderMountDuration; }
+
+	bool IsAtLadderTop() const;
+	bool IsAtLadderBottom() const;
+
+	virtual float GetMaxSpeed() const override;
+
+protected:
+	virtual void PhysCustom(float DeltaTime, int32 Iterations) override;
+
+	void PhysLadder(float DeltaTime, int32 Iterations);
+	void PhysLadderMount(float DeltaTime, int32 Iterations);
+
+protected:
+	UPROPERTY(EditDefaultsOnly, Category = "Ladder")
+	float LadderClimbSpeed = 90;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Ladder")
+	float LadderAlignInterpSpeed = 12;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Ladder")
+	float LadderEndTolerance = 1;
+
+	TWeakObjectPtr<const ASoulLadderActor> ClimbingLadder;
+	float LadderDistance = 0;
+
+	FVector LadderMountStartLocation = FVector::ZeroVector;
+	FRotator LadderMountStartRotation = FRotator::ZeroRotator;
+	FVector LadderMountTargetLocation = FVector::ZeroVector;
+	FRotator LadderMountTargetRotation = FRotator::ZeroRotator;
+	float LadderMountDuration = 0;
+	float LadderMountElapsed = 0;
+};
\ No newline at end of file
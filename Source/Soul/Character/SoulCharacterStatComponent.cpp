@@ -1,4 +1,13 @@
 #include "SoulCharacterStatComponent.h"
+#include "SoulProgressionData.h"
+#include "../Common/SoulStats.h"
+
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Derived Stat Recomputes"), STAT_SoulDerivedStatRecomputes, STATGROUP_Soul);
+
+static_assert((uint8)ESoulDerivedStat::Count <= 8, "DirtyDerivedStats is a uint8 mask");
 
 USoulCharacterStatComponent::USoulCharacterStatComponent()
 {
@@ -20,31 +29,346 @@ int32 USoulCharacterStatComponent::GetLevel() const
 
 int32 USoulCharacterStatComponent::GetCurrentInvestCost() const
 {
-	const float CostFloat = (float)BaseInvestCost * FMath::Pow(CostMultiplier, (float)InvestCount);
+	return GetInvestCost(InvestCount);
+}
+
+int32 USoulCharacterStatComponent::GetInvestCost(int32 AtInvestCount) const
+{
+	if (ProgressionData && ProgressionData->HasInvestCostTable())
+	{
+		return ProgressionData->GetInvestCost(AtInvestCount);
+	}
+
+	const float CostFloat = (float)BaseInvestCost * FMath::Pow(CostMultiplier, (float)FMath::Max(AtInvestCount, 0));
 	return FMath::CeilToInt(CostFloat);
 }
 
+int64 USoulCharacterStatComponent::GetTotalInvestCost(int32 NumInvests) const
+{
+	if (ProgressionData && ProgressionData->HasInvestCostTable())
+	{
+		return ProgressionData->GetTotalInvestCost(InvestCount, NumInvests);
+	}
+
+	int64 Total = 0;
+	for (int32 Offset = 0; Offset < NumInvests; ++Offset)
+	{
+		Total += GetInvestCost(InvestCount + Offset);
+	}
+	return Total;
+}
+
 void USoulCharacterStatComponent::RecalculateDerivedStats(bool bKeepCurrentRatio)
 {
-	const float OldMaxHP = MaxHP;
-	const float OldMaxStamina = MaxStamina;
+	for (uint8 Index = 0; Index < (uint8)ESoulDerivedStat::Count; ++Index)
+	{
+		RecomputeDerivedStat((ESoulDerivedStat)Index, bKeepCurrentRatio);
+	}
+}
+
+float* USoulCharacterStatComponent::DerivedStatValue(ESoulDerivedStat Stat) const
+{
+	switch (Stat)
+	{
+	case ESoulDerivedStat::MaxHP: return &MaxHP;
+	case ESoulDerivedStat::MaxStamina: return &MaxStamina;
+	default: return &MaxHP;
+	}
+}
+
+float USoulCharacterStatComponent::GetDerivedStatBase(ESoulDerivedStat Stat) const
+{
+	switch (Stat)
+	{
+	case ESoulDerivedStat::MaxHP: return GetDerivedStatBaseAt(Stat, VIT);
+	case ESoulDerivedStat::MaxStamina: return GetDerivedStatBaseAt(Stat, END);
+	default: return 0;
+	}
+}
+
+float USoulCharacterStatComponent::GetDerivedStatBaseAt(ESoulDerivedStat Stat, int32 AttributeLevel) const
+{
+	switch (Stat)
+	{
+	case ESoulDerivedStat::MaxHP:
+		if (ProgressionData && ProgressionData->HasMaxHPTable())
+		{
+			return ProgressionData->GetMaxHP(AttributeLevel);
+		}
+		return HP_Base + (float)(FMath::Max(1, AttributeLevel) - 1) * HP_PerVIT;
+
+	case ESoulDerivedStat::MaxStamina:
+		if (ProgressionData && ProgressionData->HasMaxStaminaTable())
+		{
+			return ProgressionData->GetMaxStamina(AttributeLevel);
+		}
+		return Stamina_Base + (float)(FMath::Max(1, AttributeLevel) - 1) * Stamina_PerEND;
+
+	default: return 0;
+	}
+}
+
+void USoulCharacterStatComponent::MarkDerivedStatDirty(ESoulDerivedStat Stat)
+{
+	const uint8 Bit = DerivedStatBit(Stat);
+
+	if (Stat == ESoulDerivedStat::MaxStamina && (DirtyDerivedStats & Bit) == 0)
+	{
+		// Settle stamina against the cap it accrued under; the event timer is re-armed next frame
+		// so a burst of modifier changes costs one recompute.
+		RebaseStamina(MaxStamina);
+		ScheduleStaminaRefresh();
+	}
+
+	DirtyDerivedStats |= Bit;
+}
+
+float USoulCharacterStatComponent::ComputeDerivedStat(ESoulDerivedStat Stat) const
+{
+	INC_DWORD_STAT(STAT_SoulDerivedStatRecomputes);
+
+	float Additive = 0;
+	float Multiplier = 1;
+	uint32 OverrideSerial = 0;
+	float OverrideValue = 0;
 
-	MaxHP = HP_Base + (float)(FMath::Max(1, VIT) - 1) * HP_PerVIT;
-	MaxStamina = Stamina_Base + (float)(FMath::Max(1, END) - 1) * Stamina_PerEND;
+	for (const FActiveStatModifier& Active : Modifiers)
+	{
+		if (Active.Modifier.Stat != Stat)
+		{
+			continue;
+		}
+
+		switch (Active.Modifier.Op)
+		{
+		case ESoulStatModifierOp::Additive:
+			Additive += Active.Modifier.Value;
+			break;
+
+		case ESoulStatModifierOp::Multiplicative:
+			Multiplier *= Active.Modifier.Value;
+			break;
+
+		case ESoulStatModifierOp::Override:
+			if (Active.Serial > OverrideSerial)
+			{
+				OverrideSerial = Active.Serial;
+				OverrideValue = Active.Modifier.Value;
+			}
+			break;
+		}
+	}
 
+	return FMath::Max<float>(OverrideSerial != 0 ? OverrideValue : (GetDerivedStatBase(Stat) + Additive) * Multiplier, 0);
+}
+
+void USoulCharacterStatComponent::RecomputeDerivedStat(ESoulDerivedStat Stat, bool bKeepCurrentRatio)
+{
+	float* Value = DerivedStatValue(Stat);
+	const float OldMax = *Value;
+
+	if (Stat == ESoulDerivedStat::MaxStamina)
+	{
+		RebaseStamina(OldMax);
+	}
+
+	const float NewMax = ComputeDerivedStat(Stat);
+	*Value = NewMax;
+	DirtyDerivedStats &= ~DerivedStatBit(Stat);
+
+	float& Current = (Stat == ESoulDerivedStat::MaxHP) ? HP : Stamina;
 	if (bKeepCurrentRatio)
 	{
-		const float HPRatio = (OldMaxHP > 0) ? (HP / OldMaxHP) : 1;
-		const float StRatio = (OldMaxStamina > 0) ? (Stamina / OldMaxStamina) : 1;
+		const float Ratio = (OldMax > 0) ? (Current / OldMax) : 1;
+		Current = FMath::Clamp<float>(NewMax * Ratio, 0, NewMax);
+	}
+	else
+	{
+		Current = FMath::Clamp<float>(Current, 0, NewMax);
+	}
+
+	if (Stat == ESoulDerivedStat::MaxStamina)
+	{
+		ScheduleStaminaEvent();
+	}
+}
+
+double USoulCharacterStatComponent::GetStatTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0;
+}
+
+float USoulCharacterStatComponent::EvaluateStamina(double Time, float MaxValue) const
+{
+	if (StaminaDrainRate > 0)
+	{
+		return FMath::Clamp<float>(Stamina - StaminaDrainRate * (Time - StaminaAnchorTime), 0, MaxValue);
+	}
+
+	if (!bCanRegenStamina)
+	{
+		return FMath::Min<float>(Stamina, MaxValue);
+	}
+
+	const double RegenFrom = FMath::Max(StaminaAnchorTime, StaminaRegenStartTime);
+	return FMath::Min<float>(Stamina + StaminaRegenRate * FMath::Max(0.0, Time - RegenFrom), MaxValue);
+}
+
+void USoulCharacterStatComponent::RebaseStamina(float MaxValue)
+{
+	const double Now = GetStatTime();
+	Stamina = EvaluateStamina(Now, MaxValue);
+	StaminaAnchorTime = Now;
+}
+
+float USoulCharacterStatComponent::GetStamina() const
+{
+	return EvaluateStamina(GetStatTime(), GetMaxStamina());
+}
 
-		HP = FMath::Clamp(MaxHP * HPRatio, 0, MaxHP);
-		Stamina = FMath::Clamp(MaxStamina * StRatio, 0, MaxStamina);
+bool USoulCharacterStatComponent::ConsumeStamina(float Amount)
+{
+	const float MaxValue = GetMaxStamina();
+	RebaseStamina(MaxValue);
+
+	if (Stamina <= 0)
+	{
+		return false;
+	}
+
+	Stamina = FMath::Max<float>(Stamina - Amount, 0);
+	StaminaRegenStartTime = StaminaAnchorTime + StaminaRegenDelay;
+
+	ScheduleStaminaEvent();
+	return true;
+}
+
+void USoulCharacterStatComponent::SetStaminaDrainRate(float Rate)
+{
+	Rate = FMath::Max<float>(Rate, 0);
+	if (Rate == StaminaDrainRate)
+	{
+		return;
+	}
+
+	RebaseStamina(GetMaxStamina());
+
+	if (Rate <= 0)
+	{
+		StaminaRegenStartTime = StaminaAnchorTime + StaminaRegenDelay;
+	}
+
+	StaminaDrainRate = Rate;
+	ScheduleStaminaEvent();
+}
+
+void USoulCharacterStatComponent::ScheduleStaminaEvent()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	TimerManager.ClearTimer(StaminaTimer);
+
+	double EventTime = 0;
+	if (StaminaDrainRate > 0)
+	{
+		if (Stamina <= 0)
+		{
+			return;
+		}
+		EventTime = StaminaAnchorTime + Stamina / StaminaDrainRate;
 	}
 	else
 	{
-		HP = FMath::Clamp(HP, 0, MaxHP);
-		Stamina = FMath::Clamp(Stamina, 0, MaxStamina);
+		const float MaxValue = GetMaxStamina();
+		if (!bCanRegenStamina || StaminaRegenRate <= 0 || Stamina >= MaxValue)
+		{
+			return;
+		}
+		EventTime = FMath::Max(StaminaAnchorTime, StaminaRegenStartTime) + (MaxValue - Stamina) / StaminaRegenRate;
+	}
+
+	const float Delay = FMath::Max<float>(EventTime - World->GetTimeSeconds(), KINDA_SMALL_NUMBER);
+	TimerManager.SetTimer(StaminaTimer, this, &USoulCharacterStatComponent::OnStaminaTimer, Delay, false);
+}
+
+void USoulCharacterStatComponent::ScheduleStaminaRefresh()
+{
+	UWorld* World = GetWorld();
+	if (bStaminaRefreshPending || !World)
+	{
+		return;
+	}
+
+	bStaminaRefreshPending = true;
+	World->GetTimerManager().SetTimerForNextTick(this, &USoulCharacterStatComponent::OnStaminaRefresh);
+}
+
+void USoulCharacterStatComponent::OnStaminaRefresh()
+{
+	bStaminaRefreshPending = false;
+
+	RebaseStamina(GetMaxStamina());
+	ScheduleStaminaEvent();
+}
+
+void USoulCharacterStatComponent::OnStaminaTimer()
+{
+	const float MaxValue = GetMaxStamina();
+	RebaseStamina(MaxValue);
+
+	// The timer may have been scheduled against an older anchor; only report events that actually happened.
+	const float Target = (StaminaDrainRate > 0) ? 0 : MaxValue;
+	if (!FMath::IsNearlyEqual(Stamina, Target, KINDA_SMALL_NUMBER))
+	{
+		ScheduleStaminaEvent();
+		return;
+	}
+
+	Stamina = Target;
+
+	if (StaminaDrainRate > 0)
+	{
+		OnStaminaExhausted.Broadcast();
+		return;
 	}
+
+	OnStaminaRegenComplete.Broadcast();
+}
+
+FSoulStatModifierHandle USoulCharacterStatComponent::AddModifier(const FSoulStatModifier& Modifier)
+{
+	FActiveStatModifier Active;
+	Active.Modifier = Modifier;
+	Active.Serial = NextModifierSerial++;
+
+	FSoulStatModifierHandle Handle;
+	Handle.Index = Modifiers.Add(Active);
+	Handle.Serial = Active.Serial;
+
+	MarkDerivedStatDirty(Modifier.Stat);
+
+	return Handle;
+}
+
+bool USoulCharacterStatComponent::RemoveModifier(FSoulStatModifierHandle& Handle)
+{
+	if (!Handle.IsValid() || !Modifiers.IsValidIndex(Handle.Index) || Modifiers[Handle.Index].Serial != Handle.Serial)
+	{
+		Handle.Invalidate();
+		return false;
+	}
+
+	MarkDerivedStatDirty(Modifiers[Handle.Index].Modifier.Stat);
+	Modifiers.RemoveAt(Handle.Index);
+
+	Handle.Invalidate();
+	return true;
 }
 
 bool USoulCharacterStatComponent::TryInvestStat(ECharacterStatType StatToIncrease)
@@ -62,7 +386,14 @@ bool USoulCharacterStatComponent::TryInvestStat(ECharacterStatType StatToIncreas
 
 	InvestCount += 1;
 
-	RecalculateDerivedStats(true);
+	if (StatToIncrease == ECharacterStatType::VIT)
+	{
+		MarkDerivedStatDirty(ESoulDerivedStat::MaxHP);
+	}
+	else if (StatToIncrease == ECharacterStatType::END)
+	{
+		MarkDerivedStatDirty(ESoulDerivedStat::MaxStamina);
+	}
 
 	return true;
 }
@@ -84,9 +415,10 @@ bool USoulCharacterStatComponent::ApplyDamage(float DamageAmount)
 		return false;
 	}
 
-	const float OldHP = HP;
+	const float CurrentMaxHP = GetMaxHP();
+	const float OldHP = FMath::Min(HP, CurrentMaxHP);
 
-	HP = FMath::Clamp(HP - DamageAmount, 0, MaxHP);
+	HP = FMath::Clamp(HP - DamageAmount, 0, CurrentMaxHP);
 
 	if (HP <= 0 && OldHP > 0)
 	{
@@ -104,8 +436,10 @@ bool USoulCharacterStatComponent::IsDead() const
 void USoulCharacterStatComponent::ResetCurrentToMax()
 {
 	RecalculateDerivedStats(false);
-	HP = MaxHP;
-	Stamina = MaxStamina;
+	HP = GetMaxHP();
+	Stamina = GetMaxStamina();
+	StaminaAnchorTime = GetStatTime();
+	ScheduleStaminaEvent();
 }
 
 int32 USoulCharacterStatComponent::GetStatRef(ECharacterStatType StatType) const
@@ -2,9 +2,13 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "../Common/StatTypes.h"
 #include "SoulCharacterStatComponent.generated.h"
 
+class USoulProgressionData;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDead);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnStaminaEvent);
 
 UENUM(BlueprintType)
 enum class ECharacterStatType : uint8
@@ -15,6 +19,15 @@ enum class ECharacterStatType : uint8
 	END UMETA(DisplayName = "END"),
 };
 
+struct FSoulStatModifierHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Serial = 0;
+
+	FORCEINLINE bool IsValid() const { return Index != INDEX_NONE; }
+	FORCEINLINE void Invalidate() { Index = INDEX_NONE; Serial = 0; }
+};
+
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class SOUL_API USoulCharacterStatComponent : public UActorComponent
 {
@@ -29,6 +42,12 @@ public:
 	UFUNCTION()
 	int32 GetCurrentInvestCost() const;
 
+	UFUNCTION(BlueprintPure, Category = "Stats")
+	int32 GetInvestCost(int32 AtInvestCount) const;
+
+	UFUNCTION(BlueprintPure, Category = "Stats")
+	int64 GetTotalInvestCost(int32 NumInvests) const;
+
 	UFUNCTION()
 	void RecalculateDerivedStats(bool bKeepCurrentRatio = true);
 
@@ -47,12 +66,85 @@ public:
 	UFUNCTION()
 	void ResetCurrentToMax();
 
+	UFUNCTION(BlueprintPure, Category = "Stats")
+	float GetStamina() const;
+
+	UFUNCTION(BlueprintPure, Category = "Stats")
+	bool HasStamina() const { return GetStamina() > 0; }
+
+	bool ConsumeStamina(float Amount);
+	void SetStaminaDrainRate(float Rate);
+
+	FSoulStatModifierHandle AddModifier(const FSoulStatModifier& Modifier);
+	bool RemoveModifier(FSoulStatModifierHandle& Handle);
+
+	UFUNCTION(BlueprintPure, Category = "Stats")
+	float GetHP() const { return FMath::Min(HP, GetMaxHP()); }
+
+	UFUNCTION(BlueprintPure, Category = "Stats")
+	float GetMaxHP() const { return GetDerivedStat(ESoulDerivedStat::MaxHP); }
+
+	UFUNCTION(BlueprintPure, Category = "Stats")
+	float GetMaxStamina() const { return GetDerivedStat(ESoulDerivedStat::MaxStamina); }
+
+	float GetDerivedStatBaseAt(ESoulDerivedStat Stat, int32 AttributeLevel) const;
+
+	// Modifier and invest changes only set the dirty bit; the first read after them pays for the recompute.
+	FORCEINLINE float GetDerivedStat(ESoulDerivedStat Stat) const
+	{
+		if (DirtyDerivedStats & DerivedStatBit(Stat))
+		{
+			*DerivedStatValue(Stat) = ComputeDerivedStat(Stat);
+			DirtyDerivedStats &= ~DerivedStatBit(Stat);
+		}
+		return *DerivedStatValue(Stat);
+	}
+
 protected:
 	virtual void BeginPlay() override;
 
 	int32 GetStatRef(ECharacterStatType StatType) const;
 	void AddToStat(ECharacterStatType StatType, int32 Delta);
 
+	static FORCEINLINE uint8 DerivedStatBit(ESoulDerivedStat Stat) { return (uint8)(1 << (uint8)Stat); }
+	float* DerivedStatValue(ESoulDerivedStat Stat) const;
+	float GetDerivedStatBase(ESoulDerivedStat Stat) const;
+	float ComputeDerivedStat(ESoulDerivedStat Stat) const;
+
+	void MarkDerivedStatDirty(ESoulDerivedStat Stat);
+	void RecomputeDerivedStat(ESoulDerivedStat Stat, bool bKeepCurrentRatio = true);
+
+	struct FActiveStatModifier
+	{
+		FSoulStatModifier Modifier;
+		uint32 Serial = 0;
+	};
+
+	TSparseArray<FActiveStatModifier> Modifiers;
+	uint32 NextModifierSerial = 1;
+
+	mutable uint8 DirtyDerivedStats = 0;
+
+	// Cached derived values, refreshed on read while dirty. Read them through GetMaxHP()/GetMaxStamina().
+	mutable float MaxHP = 300;
+	mutable float MaxStamina = 100;
+
+	double GetStatTime() const;
+	float EvaluateStamina(double Time, float MaxValue) const;
+	void RebaseStamina(float MaxValue);
+	void ScheduleStaminaEvent();
+	void ScheduleStaminaRefresh();
+	void OnStaminaRefresh();
+	void OnStaminaTimer();
+
+	bool bStaminaRefreshPending = false;
+
+	double StaminaAnchorTime = 0;
+	double StaminaRegenStartTime = 0;
+	float StaminaDrainRate = 0;
+
+	FTimerHandle StaminaTimer;
+
 public:	
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
 	int32 STR = 1;
@@ -66,16 +158,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
 	int32 END = 1;
 
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
-	float MaxHP = 300;
-
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
-	float MaxStamina = 100;
-
+	// Not rescaled when a modifier changes MaxHP; GetHP() clamps it to the current cap.
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
 	float HP = 300;
 
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
+	// Stamina as of StaminaAnchorTime only; read GetStamina() for the current value.
+	UPROPERTY(VisibleInstanceOnly, Category = "Stats")
 	float Stamina = 100;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
@@ -93,6 +181,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
 	int32 Souls = 0;
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
+	TObjectPtr<USoulProgressionData> ProgressionData;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
 	int32 BaseInvestCost = 100;
 
@@ -113,4 +204,10 @@ public:
 
 	UPROPERTY(BlueprintAssignable)
 	FOnDead OnDead;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnStaminaEvent OnStaminaExhausted;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnStaminaEvent OnStaminaRegenComplete;
 };
\ No newline at end of file
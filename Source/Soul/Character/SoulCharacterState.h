@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class ESoulCharacterState : uint16
+{
+	None            = 0,
+	Sprinting       = 1 << 0,
+	Attacking       = 1 << 1,
+	Dodging         = 1 << 2,
+	DodgeInvincible = 1 << 3,
+	Aiming          = 1 << 4,
+	Hit             = 1 << 5,
+	Dead            = 1 << 6,
+	OnLadder        = 1 << 7,
+	LadderMounting  = 1 << 8,
+	TopMountMoving  = 1 << 9,
+	AutoFacing      = 1 << 10,
+};
+ENUM_CLASS_FLAGS(ESoulCharacterState);
+
+enum class ESoulCharacterAction : uint8
+{
+	None     = 0,
+	Attack   = 1 << 0,
+	Dodge    = 1 << 1,
+	Swap     = 1 << 2,
+	Aim      = 1 << 3,
+	Sprint   = 1 << 4,
+	Interact = 1 << 5,
+	LockOn   = 1 << 6,
+	All      = 0x7F,
+};
+ENUM_CLASS_FLAGS(ESoulCharacterAction);
+
+namespace SoulCharacterState
+{
+	constexpr uint32 NumStateBits = 11;
+	constexpr uint32 NumStates = 1u << NumStateBits;
+
+	// States whose animation must never be throttled by the animation budget allocator.
+	constexpr ESoulCharacterState NeverSkipAnimStates = ESoulCharacterState::Attacking | ESoulCharacterState::Dodging | ESoulCharacterState::Hit;
+
+	constexpr ESoulCharacterAction ComputeAllowedActions(ESoulCharacterState State)
+	{
+		if (EnumHasAnyFlags(State, ESoulCharacterState::Dead))
+		{
+			return ESoulCharacterAction::None;
+		}
+
+		ESoulCharacterAction Allowed = ESoulCharacterAction::All;
+
+		if (EnumHasAnyFlags(State, ESoulCharacterState::OnLadder | ESoulCharacterState::LadderMounting | ESoulCharacterState::TopMountMoving))
+		{
+			Allowed &= ~(ESoulCharacterAction::Attack | ESoulCharacterAction::Dodge | ESoulCharacterAction::Swap | ESoulCharacterAction::Aim | ESoulCharacterAction::Sprint | ESoulCharacterAction::LockOn);
+		}
+
+		if (EnumHasAnyFlags(State, ESoulCharacterState::Attacking | ESoulCharacterState::Dodging))
+		{
+			Allowed &= ~ESoulCharacterAction::Dodge;
+		}
+
+		return Allowed;
+	}
+
+	struct FAllowedActionTable
+	{
+		uint8 Actions[NumStates] = {};
+
+		constexpr FAllowedActionTable()
+		{
+			for (uint32 State = 0; State < NumStates; ++State)
+			{
+				Actions[State] = (uint8)ComputeAllowedActions((ESoulCharacterState)State);
+			}
+		}
+	};
+
+	inline constexpr FAllowedActionTable AllowedActions;
+}
\ No newline at end of file
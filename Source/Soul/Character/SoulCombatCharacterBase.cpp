@@ -0,0 +1,650 @@
+#include "SoulCombatCharacterBase.h"
+#include "SoulAnimInstance.h"
+#include "SoulCharacterStatComponent.h"
+#include "SoulWeaponComponent.h"
+#include "SoulWeaponData.h"
+#include "SoulAnimBudgetSubsystem.h"
+#include "../UI/FloatingDamageActor.h"
+#include "../UI/SoulDamageTextPoolSubsystem.h"
+#include "../UI/SoulDamageNumberSubsystem.h"
+#include "../Common/SoulStats.h"
+#include "../Common/SoulCombatTelemetry.h"
+#include "../Combat/SoulDamageQueueSubsystem.h"
+#include "../Combat/SoulCombatSpatialSubsystem.h"
+
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "SkeletalMeshComponentBudgeted.h"
+#include "EngineUtils.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Serialization/ArchiveCountMem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Combat Character Tick"), STAT_SoulCombatCharacterTick, STATGROUP_Soul);
+DECLARE_CYCLE_STAT(TEXT("AttackCheck (Sync)"), STAT_SoulAttackCheckSync, STATGROUP_Soul);
+DECLARE_CYCLE_STAT(TEXT("AttackCheck (Async Submit)"), STAT_SoulAttackCheckAsync, STATGROUP_Soul);
+DECLARE_CYCLE_STAT(TEXT("AttackCheck (Async Resolve)"), STAT_SoulAttackTraceResolve, STATGROUP_Soul);
+
+static TAutoConsoleVariable<bool> CVarSoulAsyncMeleeHitCheck(
+	TEXT("soul.Combat.AsyncMeleeHitCheck"),
+	true,
+	TEXT("If true, sword hit checks are sent through the async trace API and resolved next frame against every overlapped target.\n")
+	TEXT("If false, the blocking single sweep is used. Compare with 'stat Soul'."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarSoulMeleeBroadPhase(
+	TEXT("soul.Combat.MeleeBroadPhase"),
+	true,
+	TEXT("If true, sword hit checks first ask the combatant spatial hash and skip the physics sweep when nobody is in reach."),
+	ECVF_Default);
+
+static void ReportCombatCharacterCost(UWorld* World)
+{
+	struct FClassCost
+	{
+		int32 Count = 0;
+		int32 Components = 0;
+		int32 TickingComponents = 0;
+		int32 TickingActors = 0;
+		SIZE_T MemoryBytes = 0;
+	};
+
+	TMap<const UClass*, FClassCost> Costs;
+
+	for (TActorIterator<ASoulCombatCharacterBase> It(World); It; ++It)
+	{
+		FClassCost& Cost = Costs.FindOrAdd(It->GetClass());
+		++Cost.Count;
+		Cost.TickingActors += It->IsActorTickEnabled() ? 1 : 0;
+
+		// Allocated size of each object including its containers, not just the UClass struct size.
+		FArchiveCountMem ActorMem(*It);
+		Cost.MemoryBytes += ActorMem.GetMax();
+
+		It->ForEachComponent(false, [&Cost](UActorComponent* Component)
+			{
+				++Cost.Components;
+				Cost.TickingComponents += Component->IsComponentTickEnabled() ? 1 : 0;
+
+				FArchiveCountMem ComponentMem(Component);
+				Cost.MemoryBytes += ComponentMem.GetMax();
+			});
+	}
+
+	for (const TPair<const UClass*, FClassCost>& Pair : Costs)
+	{
+		const FClassCost& Cost = Pair.Value;
+		const double Count = (double)Cost.Count;
+		UE_LOG(LogTemp, Log, TEXT("%s | Instances %d | Components %.2f | Ticking Components %.2f | Ticking Actors %.2f | Memory %.1f KB per instance (%.1f KB total)"),
+			*Pair.Key->GetName(), Cost.Count, Cost.Components / Count, Cost.TickingComponents / Count, Cost.TickingActors / Count, Cost.MemoryBytes / Count / 1024.0, Cost.MemoryBytes / 1024.0);
+	}
+}
+
+static FAutoConsoleCommandWithWorld CmdSoulReportCharacterCost(
+	TEXT("soul.Combat.ReportCharacterCost"),
+	TEXT("Prints per-class component, tick and memory cost of every combat character in the world. Pair with 'stat Soul' (Combat Character Tick) for tick time."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&ReportCombatCharacterCost));
+
+ASoulCombatCharacterBase::ASoulCombatCharacterBase(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<USkeletalMeshComponentBudgeted>(ACharacter::MeshComponentName))
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	GetCapsuleComponent()->InitCapsuleSize(42, 96);
+
+	bUseControllerRotationPitch = false;
+	bUseControllerRotationYaw = false;
+	bUseControllerRotationRoll = false;
+
+	GetCharacterMovement()->bOrientRotationToMovement = true;
+	GetCharacterMovement()->bUseControllerDesiredRotation = true;
+	GetCharacterMovement()->RotationRate = FRotator(0, 500, 0);
+
+	GetCharacterMovement()->MinAnalogWalkSpeed = 20;
+	GetCharacterMovement()->BrakingDecelerationWalking = 2000;
+	GetCharacterMovement()->BrakingDecelerationFalling = 1500;
+
+	StatComp = CreateDefaultSubobject<USoulCharacterStatComponent>(TEXT("StatComponent"));
+
+	WeaponComp = CreateDefaultSubobject<USoulWeaponComponent>(TEXT("WeaponComp"));
+
+	AttackTraceDelegate.BindUObject(this, &ASoulCombatCharacterBase::OnAttackTraceCompleted);
+}
+
+void ASoulCombatCharacterBase::Tick(float DeltaSeconds)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SoulCombatCharacterTick);
+
+	Super::Tick(DeltaSeconds);
+}
+
+void ASoulCombatCharacterBase::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (WeaponComp && DefaultSwordData)
+	{
+		WeaponComp->GiveWeapon(DefaultSwordData);
+	}
+
+	CurrentWeaponType = EWeaponType::Empty;
+
+	if (USoulDamageTextPoolSubsystem* DamageTextPool = GetWorld()->GetSubsystem<USoulDamageTextPoolSubsystem>())
+	{
+		DamageTextPool->Prewarm(DamageTextActorClass);
+	}
+
+	if (USoulCombatSpatialSubsystem* CombatSpatial = GetWorld()->GetSubsystem<USoulCombatSpatialSubsystem>())
+	{
+		CombatSpatial->RegisterCombatant(this);
+	}
+
+	if (USoulAnimBudgetSubsystem* AnimBudget = GetWorld()->GetSubsystem<USoulAnimBudgetSubsystem>())
+	{
+		AnimBudget->RegisterCharacter(this);
+	}
+}
+
+void ASoulCombatCharacterBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USoulCombatSpatialSubsystem* CombatSpatial = GetWorld()->GetSubsystem<USoulCombatSpatialSubsystem>())
+	{
+		CombatSpatial->UnregisterCombatant(this);
+	}
+
+	if (USoulAnimBudgetSubsystem* AnimBudget = GetWorld()->GetSubsystem<USoulAnimBudgetSubsystem>())
+	{
+		AnimBudget->UnregisterCharacter(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ASoulCombatCharacterBase::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+	AnimInstance = Cast<USoulAnimInstance>(GetMesh()->GetAnimInstance());
+
+	if (AnimInstance == nullptr)
+	{
+		return;
+	}
+
+	AnimInstance->OnMontageEnded.AddDynamic(this, &ASoulCombatCharacterBase::OnAttackMontageEnded);
+
+	if (WeaponComp)
+	{
+		WeaponComp->OnWeaponTraceHit.BindUObject(this, &ASoulCombatCharacterBase::ApplySwordHit);
+	}
+
+	if (StatComp)
+	{
+		StatComp->OnDead.AddDynamic(this, &ASoulCombatCharacterBase::HandleDead);
+	}
+}
+
+const ASoulCombatCharacterBase::FCombatAnimEventHandler ASoulCombatCharacterBase::CombatAnimEventHandlers[] =
+{
+	&ASoulCombatCharacterBase::OnNextAttackCheck,
+	&ASoulCombatCharacterBase::AttackCheck,
+	nullptr,
+	nullptr,
+	nullptr,
+	nullptr,
+	nullptr,
+	nullptr,
+	nullptr,
+	nullptr,
+};
+
+void ASoulCombatCharacterBase::HandleAnimEvent(ESoulAnimEvent Event)
+{
+	static_assert(UE_ARRAY_COUNT(CombatAnimEventHandlers) == (int32)ESoulAnimEvent::Count, "CombatAnimEventHandlers needs one entry per ESoulAnimEvent");
+
+	const uint8 Index = (uint8)Event;
+	if (Index >= (uint8)ESoulAnimEvent::Count || !CombatAnimEventHandlers[Index])
+	{
+		return;
+	}
+
+	(this->*CombatAnimEventHandlers[Index])();
+}
+
+void ASoulCombatCharacterBase::OnNextAttackCheck()
+{
+	CanNextCombo = true;
+
+	if (!IsComboInputOn)
+	{
+		OnActionWindowOpened();
+	}
+
+	if (!IsComboInputOn || !AnimInstance)
+	{
+		return;
+	}
+
+	const USoulWeaponData* SwordData = WeaponComp ? WeaponComp->GetEquippedData() : nullptr;
+	const int32 NextStep = SwordData ? SwordData->GetComboTransition(CurrentComboStep, QueuedComboInput) : INDEX_NONE;
+	if (NextStep == INDEX_NONE || !ConsumeSwingStamina(QueuedComboInput))
+	{
+		IsComboInputOn = false;
+		return;
+	}
+
+	AttackStartComboState(NextStep);
+	AnimInstance->JumpToAttackMontageSection(SwordData->GetComboSectionName(CurrentComboStep));
+}
+
+void ASoulCombatCharacterBase::SetState(ESoulCharacterState State, bool bEnabled)
+{
+	const uint16 NewBits = bEnabled ? (uint16)(StateBits | (uint16)State) : (uint16)(StateBits & ~(uint16)State);
+	if (NewBits == StateBits)
+	{
+		return;
+	}
+
+	FSoulCombatTelemetry::Record(ESoulCombatEvent::StateChange, this, nullptr, StateBits, NewBits);
+
+	const uint16 OldBits = StateBits;
+	StateBits = NewBits;
+
+	if ((OldBits ^ NewBits) & (uint16)SoulCharacterState::NeverSkipAnimStates)
+	{
+		if (USoulAnimBudgetSubsystem* AnimBudget = GetWorld()->GetSubsystem<USoulAnimBudgetSubsystem>())
+		{
+			AnimBudget->RefreshCharacter(this);
+		}
+	}
+
+	OnStateBitsChanged(OldBits, NewBits);
+}
+
+float ASoulCombatCharacterBase::TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
+{
+	// Queued hits were already checked for i-frames when they landed.
+	const USoulDamageQueueSubsystem* DamageQueue = GetWorld()->GetSubsystem<USoulDamageQueueSubsystem>();
+	const bool bFromDamageQueue = DamageQueue && DamageQueue->IsResolving();
+	if (!bFromDamageQueue && HasState(ESoulCharacterState::DodgeInvincible))
+	{
+		return 0;
+	}
+
+	const float ActualDamage = Super::TakeDamage(DamageAmount, DamageEvent, EventInstigator, DamageCauser);
+	const float FinalDamage = (ActualDamage > 0) ? ActualDamage : DamageAmount;
+
+	float AppliedDamage = 0;
+
+	if (StatComp)
+	{
+		if (FinalDamage > 0 && StatComp->ApplyDamage(FinalDamage))
+		{
+			OnHitDamage();
+			SpawnDamageText(this, FinalDamage);
+			AppliedDamage = FinalDamage;
+		}
+
+		FSoulCombatTelemetry::Record(ESoulCombatEvent::Damage, DamageCauser, this, FinalDamage, StatComp->GetHP());
+	}
+
+	return AppliedDamage;
+}
+
+void ASoulCombatCharacterBase::Reset()
+{
+	Super::Reset();
+
+	if (StatComp)
+	{
+		StatComp->ResetCurrentToMax();
+	}
+}
+
+bool ASoulCombatCharacterBase::IsGrounded() const
+{
+	if (const UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	{
+		return MoveComp->IsMovingOnGround();
+	}
+
+	return false;
+}
+
+bool ASoulCombatCharacterBase::IsAnimationBlockingActions() const
+{
+	return AnimInstance && AnimInstance->IsAnyMontagePlaying();
+}
+
+bool ASoulCombatCharacterBase::TryAttack(ESoulComboInput Input)
+{
+	if (!CanPerform(ESoulCharacterAction::Attack))
+	{
+		return false;
+	}
+
+	if (!IsGrounded())
+	{
+		return false;
+	}
+
+	if (IsAnimationBlockingActions() && !HasState(ESoulCharacterState::Attacking))
+	{
+		return false;
+	}
+
+	switch (CurrentWeaponType)
+	{
+	case EWeaponType::Sword:
+		return HandleSwordAttack(Input);
+
+	case EWeaponType::Gun:
+		return Input == ESoulComboInput::Light && HandleGunAttack();
+
+	default:
+		return false;
+	}
+}
+
+bool ASoulCombatCharacterBase::HandleSwordAttack(ESoulComboInput Input)
+{
+	const USoulWeaponData* SwordData = WeaponComp ? WeaponComp->GetEquippedData() : nullptr;
+	if (!SwordData || !AnimInstance)
+	{
+		return false;
+	}
+
+	if (HasState(ESoulCharacterState::Attacking))
+	{
+		if (CurrentComboStep == INDEX_NONE)
+		{
+			return false;
+		}
+		if (!CanNextCombo || SwordData->GetComboTransition(CurrentComboStep, Input) == INDEX_NONE)
+		{
+			return false;
+		}
+		if (StatComp && !StatComp->HasStamina())
+		{
+			return false;
+		}
+
+		IsComboInputOn = true;
+		QueuedComboInput = Input;
+	}
+	else
+	{
+		if (CurrentComboStep != INDEX_NONE)
+		{
+			return false;
+		}
+
+		const int32 EntryStep = SwordData->GetComboTransition(INDEX_NONE, Input);
+		if (EntryStep == INDEX_NONE || !ConsumeSwingStamina(Input))
+		{
+			return false;
+		}
+
+		AttackStartComboState(EntryStep);
+		AnimInstance->PlaySwordAttackMontage();
+		AnimInstance->JumpToAttackMontageSection(SwordData->GetComboSectionName(CurrentComboStep));
+		SetState(ESoulCharacterState::Attacking, true);
+	}
+
+	return true;
+}
+
+bool ASoulCombatCharacterBase::ConsumeSwingStamina(ESoulComboInput Input)
+{
+	if (!StatComp)
+	{
+		return true;
+	}
+
+	return StatComp->ConsumeStamina(Input == ESoulComboInput::Heavy ? HeavySwingStaminaCost : LightSwingStaminaCost);
+}
+
+void ASoulCombatCharacterBase::OnAttackMontageEnded(UAnimMontage* Montage, bool bInterrupted)
+{
+	if (HasState(ESoulCharacterState::Attacking) && CurrentComboStep != INDEX_NONE)
+	{
+		SetState(ESoulCharacterState::Attacking, false);
+		AttackEndComboState();
+
+		OnAttackEnd.Broadcast();
+	}
+
+	OnActionWindowOpened();
+}
+
+void ASoulCombatCharacterBase::AttackStartComboState(int32 ComboStep)
+{
+	++SwingId;
+	SwingHitActors.Reset();
+
+	CanNextCombo = true;
+	IsComboInputOn = false;
+	CurrentComboStep = ComboStep;
+}
+
+void ASoulCombatCharacterBase::AttackEndComboState()
+{
+	IsComboInputOn = false;
+	CanNextCombo = false;
+	CurrentComboStep = INDEX_NONE;
+	SwingHitActors.Reset();
+}
+
+void ASoulCombatCharacterBase::AttackCheck()
+{
+	const FVector Start = GetActorLocation();
+	const FVector End = Start + GetActorForwardVector() * SwordAttackRange;
+	FCollisionQueryParams Params(NAME_None, false, this);
+
+	// Pawns overlap instead of block so a cleave returns every pawn in the swing, while world geometry still stops it.
+	FCollisionResponseParams ResponseParams;
+	ResponseParams.CollisionResponse.SetResponse(ECC_Pawn, ECR_Overlap);
+
+	if (!HasAttackCandidates())
+	{
+		DrawAttackCheckDebug(false);
+		return;
+	}
+
+	if (CVarSoulAsyncMeleeHitCheck.GetValueOnGameThread())
+	{
+		SCOPE_CYCLE_COUNTER(STAT_SoulAttackCheckAsync);
+
+		GetWorld()->AsyncSweepByChannel(EAsyncTraceType::Multi, Start, End, FQuat::Identity, ECollisionChannel::ECC_GameTraceChannel2, FCollisionShape::MakeSphere(SwordAttackRadius), Params, ResponseParams, &AttackTraceDelegate, SwingId);
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SoulAttackCheckSync);
+
+	TArray<FHitResult> HitResults;
+	GetWorld()->SweepMultiByChannel(HitResults, Start, End, FQuat::Identity, ECollisionChannel::ECC_GameTraceChannel2, FCollisionShape::MakeSphere(SwordAttackRadius), Params, ResponseParams);
+
+	DrawAttackCheckDebug(HitResults.Num() > 0);
+
+	for (const FHitResult& HitResult : HitResults)
+	{
+		ApplySwordHit(HitResult);
+	}
+}
+
+bool ASoulCombatCharacterBase::HasAttackCandidates() const
+{
+	if (!CVarSoulMeleeBroadPhase.GetValueOnGameThread())
+	{
+		return true;
+	}
+
+	const USoulCombatSpatialSubsystem* CombatSpatial = GetWorld()->GetSubsystem<USoulCombatSpatialSubsystem>();
+	if (!CombatSpatial)
+	{
+		return true;
+	}
+
+	const float NearReach = SwordAttackRadius;
+	const float FarReach = SwordAttackRange + SwordAttackRadius;
+
+	return CombatSpatial->HasAnyInRadius(GetActorLocation(), NearReach, this, true)
+		|| CombatSpatial->HasAnyInCone(GetActorLocation(), GetActorForwardVector(), FarReach, SwordBroadPhaseHalfAngle, this, true);
+}
+
+void ASoulCombatCharacterBase::OnAttackTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SoulAttackTraceResolve);
+
+	if (HasState(ESoulCharacterState::Dead) || TraceDatum.UserData != SwingId)
+	{
+		return;
+	}
+
+	DrawAttackCheckDebug(TraceDatum.OutHits.Num() > 0);
+
+	for (const FHitResult& HitResult : TraceDatum.OutHits)
+	{
+		ApplySwordHit(HitResult);
+	}
+}
+
+void ASoulCombatCharacterBase::ApplySwordHit(const FHitResult& HitResult)
+{
+	AActor* HitActor = HitResult.GetActor();
+	if (!HitActor || HitActor == this)
+	{
+		return;
+	}
+
+	bool bAlreadyHit = false;
+	SwingHitActors.Add(HitActor, &bAlreadyHit);
+
+	if (bAlreadyHit)
+	{
+		return;
+	}
+
+	USoulDamageQueueSubsystem::ApplyPointDamage(HitActor, SwordDamage, GetActorForwardVector(), HitResult, GetController(), this);
+	FSoulCombatTelemetry::Record(ESoulCombatEvent::Hit, this, HitActor, SwordDamage);
+}
+
+void ASoulCombatCharacterBase::BeginSwordHitWindow()
+{
+	if (CurrentWeaponType != EWeaponType::Sword || HasState(ESoulCharacterState::Dead) || !WeaponComp)
+	{
+		return;
+	}
+
+	WeaponComp->BeginHitWindow();
+}
+
+void ASoulCombatCharacterBase::TickSwordHitWindow(float DeltaSeconds)
+{
+	if (WeaponComp)
+	{
+		WeaponComp->TickHitWindow(DeltaSeconds);
+	}
+}
+
+void ASoulCombatCharacterBase::EndSwordHitWindow()
+{
+	if (WeaponComp)
+	{
+		WeaponComp->EndHitWindow();
+	}
+}
+
+void ASoulCombatCharacterBase::DrawAttackCheckDebug(bool bHit) const
+{
+#if ENABLE_DRAW_DEBUG
+
+	FVector TraceVec = GetActorForwardVector() * SwordAttackRange;
+	FVector Center = GetActorLocation() + TraceVec * 0.5;
+	float HalfHeight = SwordAttackRange * 0.5 + SwordAttackRadius;
+	FQuat CapsuleRot = FRotationMatrix::MakeFromZ(TraceVec).ToQuat();
+	FColor DrawColor = bHit ? FColor::Green : FColor::Red;
+	float DebugLifeTime = 5;
+
+	DrawDebugCapsule(GetWorld(), Center, HalfHeight, SwordAttackRadius, CapsuleRot, DrawColor, false, DebugLifeTime);
+
+#endif
+}
+
+void ASoulCombatCharacterBase::HandleDead()
+{
+	if (HasState(ESoulCharacterState::Dead))
+	{
+		return;
+	}
+
+	SetState(ESoulCharacterState::Dead, true);
+
+	FSoulCombatTelemetry::Record(ESoulCombatEvent::Death, nullptr, this);
+
+	EndSwordHitWindow();
+
+	GetCharacterMovement()->DisableMovement();
+
+	SetState(ESoulCharacterState::Attacking, false);
+
+	SetActorEnableCollision(false);
+}
+
+void ASoulCombatCharacterBase::OnHitDamage()
+{
+	if (HasState(ESoulCharacterState::Dead))
+	{
+		return;
+	}
+
+	if (AnimInstance)
+	{
+		AnimInstance->PlayHitReactMontage();
+	}
+
+	SetState(ESoulCharacterState::Hit, true);
+
+	GetWorldTimerManager().SetTimer(HitRecoveryTimer, [this]() {
+		SetState(ESoulCharacterState::Hit, false);
+		OnActionWindowOpened();
+		}, 0.3, false);
+}
+
+void ASoulCombatCharacterBase::SpawnDamageText(AActor* DamagedActor, float Damage)
+{
+	if (!DamagedActor)
+	{
+		return;
+	}
+
+	FVector TargetLocation = DamagedActor->GetActorLocation() + FVector(0, 0, 100);
+
+	if (USoulDamageNumberSubsystem::IsBatchedRenderingEnabled())
+	{
+		if (USoulDamageNumberSubsystem* DamageNumbers = GetWorld()->GetSubsystem<USoulDamageNumberSubsystem>())
+		{
+			DamageNumbers->AddDamageNumber(TargetLocation, Damage);
+			return;
+		}
+	}
+
+	if (!DamageTextActorClass)
+	{
+		return;
+	}
+
+	if (USoulDamageTextPoolSubsystem* DamageTextPool = GetWorld()->GetSubsystem<USoulDamageTextPoolSubsystem>())
+	{
+		DamageTextPool->ShowDamage(DamageTextActorClass, TargetLocation, Damage);
+		return;
+	}
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AFloatingDamageActor* DamageText = GetWorld()->SpawnActor<AFloatingDamageActor>(DamageTextActorClass, TargetLocation, FRotator::ZeroRotator, Params);
+	if (DamageText)
+	{
+		DamageText->SetDamage(Damage);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Character.h"
+#include "Engine/World.h"
+#include "../Common/WeaponTypes.h"
+#include "../Common/AnimEventTypes.h"
+#include "SoulCharacterState.h"
+#include "SoulCombatCharacterBase.generated.h"
+
+class USoulCharacterStatComponent;
+class USoulWeaponComponent;
+class USoulWeaponData;
+
+DECLARE_MULTICAST_DELEGATE(FOnAttackEndDelegate);
+
+UCLASS()
+class SOUL_API ASoulCombatCharacterBase : public ACharacter
+{
+	GENERATED_BODY()
+
+public:
+	ASoulCombatCharacterBase(const FObjectInitializer& ObjectInitializer);
+
+	FORCEINLINE bool GetIsSprinting() const { return HasState(ESoulCharacterState::Sprinting); }
+	FORCEINLINE bool GetIsAttacking() const { return HasState(ESoulCharacterState::Attacking); }
+	FORCEINLINE EWeaponType GetCurrentWeaponType() const { return CurrentWeaponType; }
+	FORCEINLINE bool GetIsAiming() const { return HasState(ESoulCharacterState::Aiming); }
+	FORCEINLINE bool GetIsDead() const { return HasState(ESoulCharacterState::Dead); }
+	FORCEINLINE bool GetIsHit() const { return HasState(ESoulCharacterState::Hit); }
+	FORCEINLINE bool IsOnLadder() const { return HasState(ESoulCharacterState::OnLadder); }
+
+	FORCEINLINE uint16 GetStateBits() const { return StateBits; }
+	FORCEINLINE bool HasState(ESoulCharacterState State) const { return (StateBits & (uint16)State) != 0; }
+	FORCEINLINE bool CanPerform(ESoulCharacterAction Action) const { return (SoulCharacterState::AllowedActions.Actions[StateBits] & (uint8)Action) != 0; }
+	FORCEINLINE bool CanReceiveDamage() const { return !HasState(ESoulCharacterState::DodgeInvincible) && !GetIsDead(); }
+
+	bool TryAttack(ESoulComboInput Input);
+
+	void BeginSwordHitWindow();
+	void TickSwordHitWindow(float DeltaSeconds);
+	void EndSwordHitWindow();
+
+	virtual void HandleAnimEvent(ESoulAnimEvent Event);
+
+protected:
+	void SetState(ESoulCharacterState State, bool bEnabled);
+	virtual void OnStateBitsChanged(uint16 OldBits, uint16 NewBits) {}
+
+	virtual void OnActionWindowOpened() {}
+
+	virtual void BeginPlay() override;
+	virtual void Tick(float DeltaSeconds) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void PostInitializeComponents() override;
+	virtual float TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser) override;
+	virtual void Reset() override;
+
+	bool IsGrounded() const;
+	bool IsAnimationBlockingActions() const;
+
+	bool HandleSwordAttack(ESoulComboInput Input);
+	bool ConsumeSwingStamina(ESoulComboInput Input);
+	virtual bool HandleGunAttack() { return false; }
+
+	UFUNCTION()
+	void OnAttackMontageEnded(UAnimMontage* Montage, bool bInterrupted);
+
+	void AttackStartComboState(int32 ComboStep);
+	void AttackEndComboState();
+	void AttackCheck();
+	void OnAttackTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+	void ApplySwordHit(const FHitResult& HitResult);
+	void DrawAttackCheckDebug(bool bHit) const;
+	bool HasAttackCandidates() const;
+
+	void OnNextAttackCheck();
+
+	using FCombatAnimEventHandler = void (ASoulCombatCharacterBase::*)();
+	static const FCombatAnimEventHandler CombatAnimEventHandlers[];
+
+	UFUNCTION()
+	virtual void HandleDead();
+
+	void OnHitDamage();
+
+	void SpawnDamageText(AActor* DamagedActor, float Damage);
+
+protected:
+	FOnAttackEndDelegate OnAttackEnd;
+
+	UPROPERTY()
+	TObjectPtr<class USoulAnimInstance> AnimInstance;
+
+	UPROPERTY(VisibleInstanceOnly, Category = "State")
+	uint16 StateBits = 0;
+
+	UPROPERTY(VisibleInstanceOnly, Category = "Weapon")
+	bool CanNextCombo;
+
+	UPROPERTY(VisibleInstanceOnly, Category = "Weapon")
+	bool IsComboInputOn;
+
+	UPROPERTY(VisibleInstanceOnly, Category = "Weapon")
+	int32 CurrentComboStep = INDEX_NONE;
+
+	UPROPERTY(VisibleInstanceOnly, Category = "Weapon")
+	ESoulComboInput QueuedComboInput = ESoulComboInput::Light;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Weapon")
+	EWeaponType CurrentWeaponType = EWeaponType::Empty;
+
+	UPROPERTY(VisibleInstanceOnly, Category = "Weapon")
+	float SwordAttackRange = 130;
+
+	UPROPERTY(VisibleInstanceOnly, Category = "Weapon")
+	float SwordAttackRadius = 50;
+
+	// The sweep is a capsule of SwordAttackRadius around the forward segment, so beside the origin it
+	// reaches 90 degrees off forward. Keep this at 90 or more; the extra 10 covers the capsule's rounded end.
+	UPROPERTY(EditAnywhere, Category = "Weapon|Sword", meta = (ClampMin = "90", ClampMax = "180"))
+	float SwordBroadPhaseHalfAngle = 100;
+
+	UPROPERTY(EditAnywhere, Category = "Weapon|Sword")
+	float SwordDamage = 20;
+
+	UPROPERTY(EditAnywhere, Category = "Stamina", meta = (ClampMin = "0"))
+	float LightSwingStaminaCost = 15;
+
+	UPROPERTY(EditAnywhere, Category = "Stamina", meta = (ClampMin = "0"))
+	float HeavySwingStaminaCost = 25;
+
+	FTraceDelegate AttackTraceDelegate;
+
+	TSet<TWeakObjectPtr<AActor>> SwingHitActors;
+
+	uint32 SwingId = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	TObjectPtr<USoulCharacterStatComponent> StatComp;
+
+	FTimerHandle HitRecoveryTimer;
+
+	UPROPERTY(EditDefaultsOnly, Category = "UI")
+	TSubclassOf<class AFloatingDamageActor> DamageTextActorClass;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Weapon", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<USoulWeaponComponent> WeaponComp;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Weapon")
+	TObjectPtr<USoulWeaponData> DefaultSwordData;
+};
\ No newline at end of file
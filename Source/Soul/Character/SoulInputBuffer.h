@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class ESoulBufferedAction : uint8
+{
+	None,
+	LightAttack,
+	HeavyAttack,
+	Dodge,
+	SwapGun
+};
+
+struct FSoulBufferedInput
+{
+	double Timestamp = 0;
+	ESoulBufferedAction Action = ESoulBufferedAction::None;
+};
+
+struct FSoulInputBuffer
+{
+	static constexpr int32 Capacity = 8;
+
+	void Push(ESoulBufferedAction Action, double Timestamp)
+	{
+		FSoulBufferedInput& Entry = Entries[Head];
+		Entry.Timestamp = Timestamp;
+		Entry.Action = Action;
+
+		Head = (Head + 1) % Capacity;
+		Num = FMath::Min(Num + 1, Capacity);
+	}
+
+	FORCEINLINE int32 GetNum() const { return Num; }
+
+	FORCEINLINE FSoulBufferedInput& GetFromOldest(int32 Offset)
+	{
+		return Entries[(Head - Num + Offset + Capacity) % Capacity];
+	}
+
+	void TrimConsumed()
+	{
+		while (Num > 0 && GetFromOldest(0).Action == ESoulBufferedAction::None)
+		{
+			--Num;
+		}
+	}
+
+	void Reset()
+	{
+		Num = 0;
+	}
+
+private:
+	FSoulBufferedInput Entries[Capacity];
+	int32 Head = 0;
+	int32 Num = 0;
+};
\ No newline at end of file
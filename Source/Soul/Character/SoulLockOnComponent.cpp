@@ -0,0 +1,269 @@
+#include "SoulLockOnComponent.h"
+#include "SoulCombatCharacterBase.h"
+#include "../Combat/SoulCombatSpatialSubsystem.h"
+
+#include "GameFramework/Character.h"
+
+USoulLockOnComponent::USoulLockOnComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+bool USoulLockOnComponent::ToggleLockOn()
+{
+	if (IsLockedOn())
+	{
+		ClearLockOn();
+		return false;
+	}
+
+	RefreshCandidates();
+
+	// Same per-frame trace budget as the tick. Untraced candidates count as visible, as they do
+	// after a refresh, and the tick's round-robin traces confirm the pick over the next frames.
+	const int32 NumTraces = FMath::Min(LineOfSightTracesPerFrame, Candidates.Num());
+	for (int32 Index = 0; Index < NumTraces; ++Index)
+	{
+		if (TraceLineOfSight(Candidates[Index].Character.Get()))
+		{
+			NextLineOfSightIndex = Index + 1;
+			SetLockedTarget(Index);
+			SetComponentTickEnabled(true);
+			return true;
+		}
+
+		Candidates[Index].bHasLineOfSight = false;
+	}
+
+	if (!Candidates.IsValidIndex(NumTraces))
+	{
+		return false;
+	}
+
+	NextLineOfSightIndex = NumTraces;
+	SetLockedTarget(NumTraces);
+	SetComponentTickEnabled(true);
+	return true;
+}
+
+void USoulLockOnComponent::ClearLockOn()
+{
+	SetComponentTickEnabled(false);
+
+	Candidates.Reset();
+	NextLineOfSightIndex = 0;
+	TimeSinceRefresh = 0;
+
+	SetLockedTarget(INDEX_NONE);
+}
+
+void USoulLockOnComponent::SwitchTarget(int32 Step)
+{
+	if (!IsLockedOn() || Candidates.Num() < 2 || Step == 0)
+	{
+		return;
+	}
+
+	const int32 Num = Candidates.Num();
+	const int32 BaseIndex = Candidates.IsValidIndex(LockedIndex) ? LockedIndex : 0;
+	SetLockedTarget(((BaseIndex + Step) % Num + Num) % Num);
+}
+
+void USoulLockOnComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (!IsValidTarget(LockedTarget.Get()))
+	{
+		RefreshCandidates();
+
+		if (Candidates.IsEmpty())
+		{
+			ClearLockOn();
+			return;
+		}
+
+		SetLockedTarget(0);
+		return;
+	}
+
+	TimeSinceRefresh += DeltaTime;
+	if (TimeSinceRefresh >= CandidateRefreshInterval)
+	{
+		RefreshCandidates();
+	}
+
+	UpdateLineOfSight();
+}
+
+void USoulLockOnComponent::RefreshCandidates()
+{
+	TimeSinceRefresh = 0;
+
+	const ACharacter* Owner = Cast<ACharacter>(GetOwner());
+	const USoulCombatSpatialSubsystem* CombatSpatial = GetWorld()->GetSubsystem<USoulCombatSpatialSubsystem>();
+
+	if (!Owner || !CombatSpatial)
+	{
+		Candidates.Reset();
+		return;
+	}
+
+	TArray<ACharacter*> Nearby;
+	CombatSpatial->QueryNearest(Owner->GetActorLocation(), LockOnRadius, MaxCandidates, Nearby, Owner);
+
+	decltype(Candidates) Refreshed;
+	for (ACharacter* Character : Nearby)
+	{
+		if (!IsValidTarget(Character))
+		{
+			continue;
+		}
+
+		FSoulLockOnCandidate& Candidate = Refreshed.AddDefaulted_GetRef();
+		Candidate.Character = Character;
+
+		const FSoulLockOnCandidate* Previous = Candidates.FindByPredicate([Character](const FSoulLockOnCandidate& Existing)
+			{
+				return Existing.Character.Get() == Character;
+			});
+
+		Candidate.bHasLineOfSight = Previous ? Previous->bHasLineOfSight : true;
+	}
+
+	const bool bKeepsLockedTarget = Refreshed.ContainsByPredicate([this](const FSoulLockOnCandidate& Candidate)
+		{
+			return Candidate.Character == LockedTarget;
+		});
+
+	if (LockedTarget.IsValid() && !bKeepsLockedTarget && IsValidTarget(LockedTarget.Get()))
+	{
+		FSoulLockOnCandidate& Candidate = Refreshed.AddDefaulted_GetRef();
+		Candidate.Character = LockedTarget;
+	}
+
+	Candidates = MoveTemp(Refreshed);
+	NextLineOfSightIndex = 0;
+
+	RankCandidates();
+}
+
+void USoulLockOnComponent::UpdateLineOfSight()
+{
+	const int32 NumTraces = FMath::Min(LineOfSightTracesPerFrame, Candidates.Num());
+	if (NumTraces == 0)
+	{
+		return;
+	}
+
+	for (int32 Trace = 0; Trace < NumTraces; ++Trace)
+	{
+		NextLineOfSightIndex %= Candidates.Num();
+
+		FSoulLockOnCandidate& Candidate = Candidates[NextLineOfSightIndex++];
+		Candidate.bHasLineOfSight = TraceLineOfSight(Candidate.Character.Get());
+		Candidate.Score = ScoreCandidate(Candidate);
+	}
+}
+
+void USoulLockOnComponent::RankCandidates()
+{
+	for (FSoulLockOnCandidate& Candidate : Candidates)
+	{
+		Candidate.Score = ScoreCandidate(Candidate);
+	}
+
+	Candidates.Sort([](const FSoulLockOnCandidate& A, const FSoulLockOnCandidate& B)
+		{
+			return A.Score > B.Score;
+		});
+
+	LockedIndex = Candidates.IndexOfByPredicate([this](const FSoulLockOnCandidate& Candidate)
+		{
+			return Candidate.Character == LockedTarget;
+		});
+}
+
+float USoulLockOnComponent::ScoreCandidate(const FSoulLockOnCandidate& Candidate) const
+{
+	const ACharacter* Owner = Cast<ACharacter>(GetOwner());
+	const ACharacter* Target = Candidate.Character.Get();
+
+	if (!Owner || !Target)
+	{
+		return -UE_BIG_NUMBER;
+	}
+
+	FVector ViewDir = Owner->GetActorForwardVector();
+	if (const AController* Controller = Owner->GetController())
+	{
+		ViewDir = Controller->GetControlRotation().Vector();
+	}
+
+	const FVector ToTarget = Target->GetActorLocation() - Owner->GetActorLocation();
+	const float Distance = ToTarget.Size();
+
+	const float AngleScore = FVector::DotProduct(ViewDir.GetSafeNormal2D(), ToTarget.GetSafeNormal2D());
+	const float DistanceScore = 1 - FMath::Clamp(Distance / FMath::Max(LockOnRadius, 1), 0, 1);
+
+	float Score = AngleWeight * AngleScore + DistanceWeight * DistanceScore;
+
+	if (!Candidate.bHasLineOfSight)
+	{
+		Score -= OccludedPenalty;
+	}
+
+	return Score;
+}
+
+bool USoulLockOnComponent::IsValidTarget(const ACharacter* Target) const
+{
+	if (!Target || Target == GetOwner())
+	{
+		return false;
+	}
+
+	if (const ASoulCombatCharacterBase* SoulTarget = Cast<ASoulCombatCharacterBase>(Target))
+	{
+		if (SoulTarget->GetIsDead())
+		{
+			return false;
+		}
+	}
+
+	return FVector::DistSquared(Target->GetActorLocation(), GetOwner()->GetActorLocation()) <= FMath::Square(BreakLockRadius);
+}
+
+bool USoulLockOnComponent::TraceLineOfSight(const ACharacter* Target) const
+{
+	const ACharacter* Owner = Cast<ACharacter>(GetOwner());
+	if (!Owner || !Target)
+	{
+		return false;
+	}
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(SoulLockOnLineOfSight), false, Owner);
+	Params.AddIgnoredActor(Target);
+
+	FVector ViewLoc;
+	FRotator ViewRot;
+	Owner->GetActorEyesViewPoint(ViewLoc, ViewRot);
+
+	return !GetWorld()->LineTraceTestByChannel(ViewLoc, Target->GetActorLocation(), ECC_Visibility, Params);
+}
+
+void USoulLockOnComponent::SetLockedTarget(int32 CandidateIndex)
+{
+	ACharacter* NewTarget = Candidates.IsValidIndex(CandidateIndex) ? Candidates[CandidateIndex].Character.Get() : nullptr;
+	LockedIndex = NewTarget ? CandidateIndex : INDEX_NONE;
+
+	// A destroyed target leaves LockedTarget stale rather than null, and clearing it still has to be broadcast.
+	if (NewTarget ? LockedTarget.Get() == NewTarget : LockedTarget.IsExplicitlyNull())
+	{
+		return;
+	}
+
+	LockedTarget = NewTarget;
+	OnLockOnTargetChanged.Broadcast(NewTarget);
+}
\ No newline at end of file
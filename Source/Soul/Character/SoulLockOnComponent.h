@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "SoulLockOnComponent.generated.h"
+
+class ACharacter;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnLockOnTargetChangedDelegate, ACharacter*);
+
+struct FSoulLockOnCandidate
+{
+	TWeakObjectPtr<ACharacter> Character;
+	float Score = 0;
+	bool bHasLineOfSight = true;
+};
+
+UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
+class SOUL_API USoulLockOnComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	USoulLockOnComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	bool ToggleLockOn();
+	void ClearLockOn();
+	void SwitchTarget(int32 Step);
+
+	FORCEINLINE bool IsLockedOn() const { return LockedTarget.IsValid(); }
+	FORCEINLINE ACharacter* GetLockedTarget() const { return LockedTarget.Get(); }
+
+	FOnLockOnTargetChangedDelegate OnLockOnTargetChanged;
+
+protected:
+	void RefreshCandidates();
+	void UpdateLineOfSight();
+	void RankCandidates();
+	float ScoreCandidate(const FSoulLockOnCandidate& Candidate) const;
+	bool IsValidTarget(const ACharacter* Target) const;
+	bool TraceLineOfSight(const ACharacter* Target) const;
+	void SetLockedTarget(int32 CandidateIndex);
+
+protected:
+	UPROPERTY(EditAnywhere, Category = "LockOn")
+	float LockOnRadius = 1500;
+
+	UPROPERTY(EditAnywhere, Category = "LockOn")
+	float BreakLockRadius = 1800;
+
+	UPROPERTY(EditAnywhere, Category = "LockOn", meta = (ClampMin = "1", ClampMax = "32"))
+	int32 MaxCandidates = 8;
+
+	UPROPERTY(EditAnywhere, Category = "LockOn")
+	float CandidateRefreshInterval = 0.25;
+
+	UPROPERTY(EditAnywhere, Category = "LockOn", meta = (ClampMin = "1"))
+	int32 LineOfSightTracesPerFrame = 2;
+
+	UPROPERTY(EditAnywhere, Category = "LockOn")
+	float AngleWeight = 1;
+
+	UPROPERTY(EditAnywhere, Category = "LockOn")
+	float DistanceWeight = 0.5;
+
+	UPROPERTY(EditAnywhere, Category = "LockOn")
+	float OccludedPenalty = 2;
+
+	TArray<FSoulLockOnCandidate, TInlineAllocator<8>> Candidates;
+
+	TWeakObjectPtr<ACharacter> LockedTarget;
+
+	int32 LockedIndex = INDEX_NONE;
+
+	int32 NextLineOfSightIndex = 0;
+
+	float TimeSinceRefresh = 0;
+};
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include "SoulProgressionData.h"
+
+void USoulProgressionData::PostLoad()
+{
+	Super::PostLoad();
+
+	BakeTables();
+}
+
+#if WITH_EDITOR
+void USoulProgressionData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	BakeTables();
+}
+#endif
+
+void USoulProgressionData::BakeTables()
+{
+	InvestCostTable.Reset();
+	CumulativeInvestCost.Reset();
+
+	TArray<float> CostValues;
+	BakeCurve(InvestCostCurve, 0, FMath::Max(1, MaxInvestCount), CostValues);
+
+	InvestCostTable.Reserve(CostValues.Num());
+	CumulativeInvestCost.Reserve(CostValues.Num() + 1);
+
+	int64 Total = 0;
+	CumulativeInvestCost.Add(Total);
+	for (const float Cost : CostValues)
+	{
+		const int32 RoundedCost = FMath::Max(0, FMath::CeilToInt(Cost));
+		InvestCostTable.Add(RoundedCost);
+
+		Total += RoundedCost;
+		CumulativeInvestCost.Add(Total);
+	}
+
+	if (InvestCostTable.IsEmpty())
+	{
+		CumulativeInvestCost.Reset();
+	}
+
+	const int32 LastLevel = FMath::Max(1, MaxAttributeLevel);
+	BakeCurve(MaxHPByVITCurve, 1, LastLevel, MaxHPTable);
+	BakeCurve(MaxStaminaByENDCurve, 1, LastLevel, MaxStaminaTable);
+}
+
+void USoulProgressionData::BakeCurve(const FRuntimeFloatCurve& Curve, int32 FirstLevel, int32 LastLevel, TArray<float>& OutTable)
+{
+	OutTable.Reset();
+
+	const FRichCurve* RichCurve = Curve.GetRichCurveConst();
+	if (!RichCurve || RichCurve->GetNumKeys() == 0)
+	{
+		return;
+	}
+
+	// Indexed by level directly; entries below FirstLevel repeat the first sample.
+	OutTable.SetNumUninitialized(LastLevel + 1);
+	for (int32 Level = FirstLevel; Level <= LastLevel; ++Level)
+	{
+		OutTable[Level] = FMath::Max<float>(RichCurve->Eval((float)Level), 0);
+	}
+	for (int32 Level = 0; Level < FirstLevel; ++Level)
+	{
+		OutTable[Level] = OutTable[FirstLevel];
+	}
+}
+
+int64 USoulProgressionData::GetTotalInvestCost(int32 FromInvestCount, int32 NumInvests) const
+{
+	if (CumulativeInvestCost.IsEmpty() || NumInvests <= 0)
+	{
+		return 0;
+	}
+
+	FromInvestCount = FMath::Max(FromInvestCount, 0);
+
+	const int32 LastIndex = InvestCostTable.Num() - 1;
+	const int32 ToInvestCount = FromInvestCount + NumInvests;
+
+	// Past the end of the table every invest costs the last baked entry.
+	const int32 TableFrom = FMath::Min(FromInvestCount, LastIndex);
+	const int32 TableTo = FMath::Min(ToInvestCount, LastIndex);
+	const int32 NumClamped = ToInvestCount - FMath::Max(FromInvestCount, LastIndex);
+
+	int64 Total = CumulativeInvestCost[TableTo] - CumulativeInvestCost[TableFrom];
+	if (NumClamped > 0)
+	{
+		Total += (int64)NumClamped * InvestCostTable[LastIndex];
+	}
+	return Total;
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Curves/CurveFloat.h"
+#include "SoulProgressionData.generated.h"
+
+UCLASS()
+class SOUL_API USoulProgressionData : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	void BakeTables();
+
+	FORCEINLINE bool HasInvestCostTable() const { return !InvestCostTable.IsEmpty(); }
+	FORCEINLINE bool HasMaxHPTable() const { return !MaxHPTable.IsEmpty(); }
+	FORCEINLINE bool HasMaxStaminaTable() const { return !MaxStaminaTable.IsEmpty(); }
+
+	FORCEINLINE int32 GetInvestCost(int32 InvestCount) const
+	{
+		return InvestCostTable[FMath::Clamp(InvestCount, 0, InvestCostTable.Num() - 1)];
+	}
+
+	int64 GetTotalInvestCost(int32 FromInvestCount, int32 NumInvests) const;
+
+	FORCEINLINE float GetMaxHP(int32 VIT) const
+	{
+		return MaxHPTable[FMath::Clamp(VIT, 1, MaxHPTable.Num() - 1)];
+	}
+
+	FORCEINLINE float GetMaxStamina(int32 END) const
+	{
+		return MaxStaminaTable[FMath::Clamp(END, 1, MaxStaminaTable.Num() - 1)];
+	}
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Progression|Invest", meta = (XAxisName = "Invest Count", YAxisName = "Souls"))
+	FRuntimeFloatCurve InvestCostCurve;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Progression|Invest", meta = (ClampMin = "1"))
+	int32 MaxInvestCount = 800;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Progression|Attributes", meta = (XAxisName = "VIT", YAxisName = "Max HP"))
+	FRuntimeFloatCurve MaxHPByVITCurve;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Progression|Attributes", meta = (XAxisName = "END", YAxisName = "Max Stamina"))
+	FRuntimeFloatCurve MaxStaminaByENDCurve;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Progression|Attributes", meta = (ClampMin = "1"))
+	int32 MaxAttributeLevel = 99;
+
+protected:
+	static void BakeCurve(const FRuntimeFloatCurve& Curve, int32 FirstLevel, int32 LastLevel, TArray<float>& OutTable);
+
+protected:
+	TArray<int32> InvestCostTable;
+
+	TArray<int64> CumulativeInvestCost;
+
+	TArray<float> MaxHPTable;
+
+	TArray<float> MaxStaminaTable;
+};
\ No newline at end of file
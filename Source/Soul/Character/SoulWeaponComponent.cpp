@@ -1,7 +1,17 @@
 #include "SoulWeaponComponent.h"
 #include "SoulWeaponData.h"
+#include "../Common/SoulCombatTelemetry.h"
 
 #include "GameFramework/Character.h"
+#include "Engine/StaticMeshSocket.h"
+#include "DrawDebugHelpers.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarSoulDrawBladeDebug(
+    TEXT("soul.Combat.DrawBladeDebug"),
+    false,
+    TEXT("Draw a debug line for every blade substep sweep."),
+    ECVF_Cheat);
 
 USoulWeaponComponent::USoulWeaponComponent()
 {
@@ -16,14 +26,11 @@ void USoulWeaponComponent::BeginPlay()
     AActor* Owner = GetOwner();
     if (!Owner) return;
 
-    EquippedStaticMeshComp = NewObject<UStaticMeshComponent>(Owner, TEXT("EquippedWeapon_StaticMesh"));
-    if (EquippedStaticMeshComp)
+    OwnerStatComp = Owner->FindComponentByClass<USoulCharacterStatComponent>();
+
+    for (const TPair<EWeaponType, TObjectPtr<USoulWeaponData>>& Pair : OwnedWeapons)
     {
-        EquippedStaticMeshComp->RegisterComponent();
-        EquippedStaticMeshComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-        EquippedStaticMeshComp->SetGenerateOverlapEvents(false);
-        EquippedStaticMeshComp->SetHiddenInGame(true);
-        EquippedStaticMeshComp->SetVisibility(false, true);
+        CreateWeaponMesh(Pair.Key, Pair.Value);
     }
 }
 
@@ -32,6 +39,78 @@ void USoulWeaponComponent::GiveWeapon(TObjectPtr<USoulWeaponData> WeaponData)
     if (!WeaponData) return;
 
     OwnedWeapons.FindOrAdd(WeaponData->WeaponType) = WeaponData;
+
+    if (HasBegunPlay())
+    {
+        CreateWeaponMesh(WeaponData->WeaponType, WeaponData);
+    }
+}
+
+UStaticMeshComponent* USoulWeaponComponent::CreateWeaponMesh(EWeaponType Type, const USoulWeaponData* Data)
+{
+    if (!Data) return nullptr;
+
+    AActor* Owner = GetOwner();
+    if (!Owner) return nullptr;
+
+    TObjectPtr<UStaticMeshComponent>& MeshComp = WeaponMeshes.FindOrAdd(Type);
+    if (!MeshComp)
+    {
+        MeshComp = NewObject<UStaticMeshComponent>(Owner, FName(TEXT("WeaponMesh"), (int32)Type + 1));
+        MeshComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+        MeshComp->SetGenerateOverlapEvents(false);
+        MeshComp->SetStaticMesh(Data->StaticMesh);
+        MeshComp->SetVisibility(Type == EquippedType || !Data->HolsterSocketName.IsNone());
+        MeshComp->RegisterComponent();
+    }
+    else if (MeshComp->GetStaticMesh() != Data->StaticMesh)
+    {
+        MeshComp->SetStaticMesh(Data->StaticMesh);
+    }
+
+    const bool bDrawn = (Type == EquippedType);
+    AttachWeaponMesh(MeshComp, Data, bDrawn);
+
+    if (bDrawn)
+    {
+        EquippedStaticMeshComp = MeshComp;
+    }
+
+    return MeshComp;
+}
+
+void USoulWeaponComponent::AttachWeaponMesh(UStaticMeshComponent* MeshComp, const USoulWeaponData* Data, bool bDrawn)
+{
+    if (!MeshComp || !Data) return;
+
+    ACharacter* OwnerChar = Cast<ACharacter>(GetOwner());
+    if (!OwnerChar || !OwnerChar->GetMesh()) return;
+
+    // Without a holster socket the mesh stays in hand and only its visibility changes.
+    const bool bHasHolster = !Data->HolsterSocketName.IsNone();
+    const FName SocketName = (bDrawn || !bHasHolster) ? Data->AttachSocketName : Data->HolsterSocketName;
+
+    if (MeshComp->GetAttachParent() != OwnerChar->GetMesh() || MeshComp->GetAttachSocketName() != SocketName)
+    {
+        MeshComp->AttachToComponent(OwnerChar->GetMesh(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, SocketName);
+        MeshComp->SetRelativeTransform(SocketName == Data->AttachSocketName ? Data->AttachOffset : Data->HolsterOffset);
+    }
+
+    const bool bVisible = bDrawn || bHasHolster;
+    if (MeshComp->IsVisible() != bVisible)
+    {
+        MeshComp->SetVisibility(bVisible);
+    }
+}
+
+void USoulWeaponComponent::HolsterEquipped()
+{
+    if (EquippedStaticMeshComp)
+    {
+        AttachWeaponMesh(EquippedStaticMeshComp, GetEquippedData(), false);
+    }
+
+    EquippedStaticMeshComp = nullptr;
 }
 
 bool USoulWeaponComponent::HasWeapon(EWeaponType Type) const
@@ -39,12 +118,21 @@ bool USoulWeaponComponent::HasWeapon(EWeaponType Type) const
     return OwnedWeapons.Contains(Type);
 }
 
+USoulWeaponData* USoulWeaponComponent::GetEquippedData() const
+{
+    TObjectPtr<USoulWeaponData> const* Found = OwnedWeapons.Find(EquippedType);
+    return Found ? Found->Get() : nullptr;
+}
+
 bool USoulWeaponComponent::EquipWeapon(EWeaponType Type)
 {
+    EndHitWindow();
+
     if (Type == EWeaponType::Empty)
     {
+        HolsterEquipped();
         EquippedType = EWeaponType::Empty;
-        ClearVisual();
+        ClearStatModifiers();
         return true;
     }
 
@@ -54,45 +142,159 @@ bool USoulWeaponComponent::EquipWeapon(EWeaponType Type)
         return false;
     }
 
+    if (Type != EquippedType)
+    {
+        HolsterEquipped();
+    }
+
     EquippedType = Type;
-    ApplyVisual(*Found);
+
+    TObjectPtr<UStaticMeshComponent> const* MeshComp = WeaponMeshes.Find(Type);
+    EquippedStaticMeshComp = MeshComp ? MeshComp->Get() : nullptr;
+    AttachWeaponMesh(EquippedStaticMeshComp, *Found, true);
+
+    FSoulCombatTelemetry::Record(ESoulCombatEvent::Swap, GetOwner(), *Found, (float)Type);
+
+    ApplyStatModifiers(*Found);
     return true;
 }
 
-void USoulWeaponComponent::ApplyVisual(USoulWeaponData* Data)
+void USoulWeaponComponent::ApplyStatModifiers(const USoulWeaponData* Data)
 {
-    if (!Data || !EquippedStaticMeshComp) return;
+    ClearStatModifiers();
 
-    ACharacter* OwnerChar = Cast<ACharacter>(GetOwner());
-    if (!OwnerChar || !OwnerChar->GetMesh()) return;
+    if (!Data || !OwnerStatComp) return;
 
-    UE_LOG(LogTemp, Warning, TEXT("[ApplyVisual] Type=%d Mesh=%s Socket=%s Owner=%s SkelMesh=%s"),
-        (int32)Data->WeaponType,
-        Data->StaticMesh ? *Data->StaticMesh->GetName() : TEXT("NULL"),
-        *Data->AttachSocketName.ToString(),
-        *GetOwner()->GetName(),
-        OwnerChar && OwnerChar->GetMesh() ? *OwnerChar->GetMesh()->GetName() : TEXT("NULL")
-    );
+    for (const FSoulStatModifier& Modifier : Data->StatModifiers)
+    {
+        EquippedModifierHandles.Add(OwnerStatComp->AddModifier(Modifier));
+    }
+}
 
-    EquippedStaticMeshComp->SetStaticMesh(Data->StaticMesh);
+void USoulWeaponComponent::ClearStatModifiers()
+{
+    if (OwnerStatComp)
+    {
+        for (FSoulStatModifierHandle& Handle : EquippedModifierHandles)
+        {
+            OwnerStatComp->RemoveModifier(Handle);
+        }
+    }
 
-    EquippedStaticMeshComp->AttachToComponent(
-        OwnerChar->GetMesh(),
-        FAttachmentTransformRules::SnapToTargetNotIncludingScale,
-        Data->AttachSocketName
-    );
+    EquippedModifierHandles.Reset();
+}
+
+void USoulWeaponComponent::BeginHitWindow()
+{
+    const USoulWeaponData* Data = GetEquippedData();
+    if (!Data || !EquippedStaticMeshComp || !EquippedStaticMeshComp->GetStaticMesh()) return;
 
-    EquippedStaticMeshComp->SetRelativeTransform(Data->AttachOffset);
+    CacheBladePoints(Data);
 
-    EquippedStaticMeshComp->SetHiddenInGame(false);
-    EquippedStaticMeshComp->SetVisibility(true, true);
+    BladeTraceRadius = Data->BladeTraceRadius;
+    HitSubstepRate = FMath::Max<float>(Data->HitSubstepRate, 1);
+    MaxHitSubsteps = FMath::Max(Data->MaxHitSubsteps, 1);
+    MaxSubstepAngle = FMath::Clamp<float>(Data->MaxSubstepAngle, 1, 90);
+
+    LastBladeTransform = EquippedStaticMeshComp->GetComponentTransform();
+    bHitWindowActive = true;
+}
+
+void USoulWeaponComponent::TickHitWindow(float DeltaSeconds)
+{
+    if (!bHitWindowActive || !EquippedStaticMeshComp) return;
+
+    const FTransform CurrentTransform = EquippedStaticMeshComp->GetComponentTransform();
+    const int32 RateSubsteps = FMath::Clamp(FMath::CeilToInt(DeltaSeconds * HitSubstepRate), 1, MaxHitSubsteps);
+
+    // The angular cap bounds how far a chord step can cut inside the real blade arc.
+    const float SweptAngle = FMath::RadiansToDegrees(LastBladeTransform.GetRotation().AngularDistance(CurrentTransform.GetRotation()));
+    const int32 AngleSubsteps = FMath::CeilToInt(SweptAngle / MaxSubstepAngle);
+    const int32 NumSubsteps = FMath::Clamp(FMath::Max(RateSubsteps, AngleSubsteps), 1, MaxAngularHitSubsteps);
+
+    FTransform From = LastBladeTransform;
+    for (int32 Step = 1; Step <= NumSubsteps; ++Step)
+    {
+        FTransform To;
+        To.Blend(LastBladeTransform, CurrentTransform, (float)Step / NumSubsteps);
+
+        TraceBladeSubstep(From, To);
+        From = To;
+    }
+
+    LastBladeTransform = CurrentTransform;
 }
 
-void USoulWeaponComponent::ClearVisual()
+void USoulWeaponComponent::EndHitWindow()
 {
-    if (!EquippedStaticMeshComp) return;
+    bHitWindowActive = false;
+    BladeLocalPoints.Reset();
+}
 
-    EquippedStaticMeshComp->SetHiddenInGame(true);
-    EquippedStaticMeshComp->SetVisibility(false, true);
-    EquippedStaticMeshComp->SetStaticMesh(nullptr);
+void USoulWeaponComponent::CacheBladePoints(const USoulWeaponData* Data)
+{
+    BladeLocalPoints.Reset();
+
+    const UStaticMesh* Mesh = EquippedStaticMeshComp->GetStaticMesh();
+
+    FVector BladeStart;
+    FVector BladeEnd;
+
+    const UStaticMeshSocket* StartSocket = Mesh->FindSocket(Data->BladeStartSocket);
+    const UStaticMeshSocket* EndSocket = Mesh->FindSocket(Data->BladeEndSocket);
+
+    if (StartSocket && EndSocket)
+    {
+        BladeStart = StartSocket->RelativeLocation;
+        BladeEnd = EndSocket->RelativeLocation;
+    }
+    else
+    {
+        const FBox Bounds = Mesh->GetBoundingBox();
+        const FVector Center = Bounds.GetCenter();
+        BladeStart = FVector(Bounds.Min.X, Center.Y, Center.Z);
+        BladeEnd = FVector(Bounds.Max.X, Center.Y, Center.Z);
+    }
+
+    const int32 NumPoints = FMath::Clamp(Data->BladeTracePoints, 2, 8);
+    for (int32 Index = 0; Index < NumPoints; ++Index)
+    {
+        BladeLocalPoints.Add(FMath::Lerp(BladeStart, BladeEnd, (float)Index / (NumPoints - 1)));
+    }
+}
+
+void USoulWeaponComponent::TraceBladeSubstep(const FTransform& From, const FTransform& To)
+{
+    UWorld* World = GetWorld();
+    if (!World) return;
+
+    FCollisionQueryParams Params(NAME_None, false, GetOwner());
+    const FCollisionShape Shape = FCollisionShape::MakeSphere(BladeTraceRadius);
+
+    // Overlap pawns so one substep can hit every pawn the blade passes through.
+    FCollisionResponseParams ResponseParams;
+    ResponseParams.CollisionResponse.SetResponse(ECC_Pawn, ECR_Overlap);
+
+    TArray<FHitResult> Hits;
+
+    for (const FVector& LocalPoint : BladeLocalPoints)
+    {
+        const FVector Start = From.TransformPosition(LocalPoint);
+        const FVector End = To.TransformPosition(LocalPoint);
+
+        Hits.Reset();
+        World->SweepMultiByChannel(Hits, Start, End, FQuat::Identity, ECollisionChannel::ECC_GameTraceChannel2, Shape, Params, ResponseParams);
+
+#if ENABLE_DRAW_DEBUG
+        if (CVarSoulDrawBladeDebug.GetValueOnGameThread())
+        {
+            DrawDebugLine(World, Start, End, Hits.Num() > 0 ? FColor::Green : FColor::Red, false, 2);
+        }
+#endif
+
+        for (const FHitResult& Hit : Hits)
+        {
+            OnWeaponTraceHit.ExecuteIfBound(Hit);
+        }
+    }
 }
\ No newline at end of file
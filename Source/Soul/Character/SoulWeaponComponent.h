@@ -3,10 +3,13 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "../Common/WeaponTypes.h"
+#include "SoulCharacterStatComponent.h"
 #include "SoulWeaponComponent.generated.h"
 
 class USoulWeaponData;
 
+DECLARE_DELEGATE_OneParam(FOnWeaponTraceHitDelegate, const FHitResult&);
+
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class SOUL_API USoulWeaponComponent : public UActorComponent
 {
@@ -20,21 +23,59 @@ public:
 	bool EquipWeapon(EWeaponType Type);
 
 	FORCEINLINE EWeaponType GetEquippedType() const { return EquippedType; }
+	FORCEINLINE UStaticMeshComponent* GetEquippedMeshComponent() const { return EquippedStaticMeshComp; }
+	USoulWeaponData* GetEquippedData() const;
+
+	void BeginHitWindow();
+	void TickHitWindow(float DeltaSeconds);
+	void EndHitWindow();
+
+	FORCEINLINE bool IsHitWindowActive() const { return bHitWindowActive; }
+
+	FOnWeaponTraceHitDelegate OnWeaponTraceHit;
 
 protected:
     virtual void BeginPlay() override;
 
-    void ApplyVisual(USoulWeaponData* Data);
-    void ClearVisual();
+    UStaticMeshComponent* CreateWeaponMesh(EWeaponType Type, const USoulWeaponData* Data);
+    void AttachWeaponMesh(UStaticMeshComponent* MeshComp, const USoulWeaponData* Data, bool bDrawn);
+    void HolsterEquipped();
+
+    void ApplyStatModifiers(const USoulWeaponData* Data);
+    void ClearStatModifiers();
+
+    void CacheBladePoints(const USoulWeaponData* Data);
+    void TraceBladeSubstep(const FTransform& From, const FTransform& To);
 
 protected:
     UPROPERTY()
     TMap<EWeaponType, TObjectPtr<USoulWeaponData>> OwnedWeapons;
 
+    UPROPERTY()
+    TMap<EWeaponType, TObjectPtr<UStaticMeshComponent>> WeaponMeshes;
+
     UPROPERTY()
     TObjectPtr<UStaticMeshComponent> EquippedStaticMeshComp;
 
     UPROPERTY()
     EWeaponType EquippedType = EWeaponType::Empty;
 
+    UPROPERTY()
+    TObjectPtr<USoulCharacterStatComponent> OwnerStatComp;
+
+    TArray<FSoulStatModifierHandle, TInlineAllocator<4>> EquippedModifierHandles;
+
+    bool bHitWindowActive = false;
+
+    FTransform LastBladeTransform;
+
+    TArray<FVector, TInlineAllocator<8>> BladeLocalPoints;
+
+    float BladeTraceRadius = 0;
+    float HitSubstepRate = 60;
+    int32 MaxHitSubsteps = 8;
+    float MaxSubstepAngle = 15;
+
+    static constexpr int32 MaxAngularHitSubsteps = 32;
+
 };
\ No newline at end of file
@@ -1,2 +1,62 @@
 #include "SoulWeaponData.h"
 
+void USoulWeaponData::PostLoad()
+{
+    Super::PostLoad();
+
+    CompileComboGraph();
+}
+
+#if WITH_EDITOR
+void USoulWeaponData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    CompileComboGraph();
+}
+#endif
+
+void USoulWeaponData::CompileComboGraph()
+{
+    ComboTransitions.Reset();
+    ComboSectionNames.Reset();
+
+    if (WeaponType != EWeaponType::Sword)
+    {
+        return;
+    }
+
+    if (ComboSteps.IsEmpty())
+    {
+        const int32 NumSteps = FMath::Max(1, DefaultComboLength);
+
+        ComboSectionNames.Reserve(NumSteps);
+        ComboTransitions.Reserve((NumSteps + 1) * (int32)ESoulComboInput::Count);
+
+        AddComboTransitions(0, INDEX_NONE, NumSteps);
+        for (int32 Step = 0; Step < NumSteps; ++Step)
+        {
+            ComboSectionNames.Add(FName(*FString::Printf(TEXT("Attack%d"), Step + 1)));
+            AddComboTransitions(Step + 1, INDEX_NONE, NumSteps);
+        }
+        return;
+    }
+
+    const int32 NumSteps = ComboSteps.Num();
+
+    ComboSectionNames.Reserve(NumSteps);
+    ComboTransitions.Reserve((NumSteps + 1) * (int32)ESoulComboInput::Count);
+
+    AddComboTransitions(LightEntryStep, HeavyEntryStep, NumSteps);
+    for (const FSoulComboStep& Step : ComboSteps)
+    {
+        ComboSectionNames.Add(Step.SectionName);
+        AddComboTransitions(Step.LightNext, Step.HeavyNext, NumSteps);
+    }
+}
+
+void USoulWeaponData::AddComboTransitions(int32 LightNext, int32 HeavyNext, int32 NumSteps)
+{
+    ComboTransitions.Add(FMath::IsWithin(LightNext, 0, NumSteps) ? LightNext : INDEX_NONE);
+    ComboTransitions.Add(FMath::IsWithin(HeavyNext, 0, NumSteps) ? HeavyNext : INDEX_NONE);
+}
\ No newline at end of file
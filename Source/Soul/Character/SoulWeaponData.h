@@ -3,14 +3,48 @@
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
 #include "../Common/WeaponTypes.h"
+#include "../Common/StatTypes.h"
 #include "SoulWeaponData.generated.h"
 
+USTRUCT(BlueprintType)
+struct FSoulComboStep
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Combo")
+    FName SectionName;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Combo")
+    int32 LightNext = INDEX_NONE;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Combo")
+    int32 HeavyNext = INDEX_NONE;
+};
+
 UCLASS()
 class SOUL_API USoulWeaponData : public UDataAsset
 {
 	GENERATED_BODY()
 	
 public:
+    virtual void PostLoad() override;
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+    void CompileComboGraph();
+
+    FORCEINLINE int32 GetComboTransition(int32 FromStep, ESoulComboInput Input) const
+    {
+        const int32 Index = (FromStep + 1) * (int32)ESoulComboInput::Count + (int32)Input;
+        return ComboTransitions.IsValidIndex(Index) ? ComboTransitions[Index] : INDEX_NONE;
+    }
+
+    FORCEINLINE FName GetComboSectionName(int32 Step) const
+    {
+        return ComboSectionNames.IsValidIndex(Step) ? ComboSectionNames[Step] : NAME_None;
+    }
+
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon")
     EWeaponType WeaponType = EWeaponType::Empty;
 
@@ -22,4 +56,67 @@ public:
 
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Attach")
     FTransform AttachOffset = FTransform::Identity;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Attach")
+    FName HolsterSocketName = NAME_None;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Attach")
+    FTransform HolsterOffset = FTransform::Identity;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Hit")
+    FName BladeStartSocket = TEXT("BladeStart");
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Hit")
+    FName BladeEndSocket = TEXT("BladeEnd");
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Hit", meta = (ClampMin = "0"))
+    float BladeTraceRadius = 8;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Hit", meta = (ClampMin = "2", ClampMax = "8"))
+    int32 BladeTracePoints = 3;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Hit", meta = (ClampMin = "1", Units = "Hz"))
+    float HitSubstepRate = 60;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Hit", meta = (ClampMin = "1"))
+    int32 MaxHitSubsteps = 8;
+
+    // Substeps interpolate the blade along a chord, so fast swings are split until each step turns at most this far.
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Hit", meta = (ClampMin = "1", ClampMax = "90", Units = "Degrees"))
+    float MaxSubstepAngle = 15;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Gun")
+    EGunFireMode FireMode = EGunFireMode::Hitscan;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Gun", meta = (EditCondition = "FireMode == EGunFireMode::Projectile", ClampMin = "1"))
+    float ProjectileSpeed = 8000;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Gun", meta = (EditCondition = "FireMode == EGunFireMode::Projectile"))
+    float ProjectileGravityScale = 1;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Gun", meta = (EditCondition = "FireMode == EGunFireMode::Projectile", ClampMin = "0.05"))
+    float ProjectileLifetime = 2;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Stats")
+    TArray<FSoulStatModifier> StatModifiers;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Combo")
+    TArray<FSoulComboStep> ComboSteps;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Combo")
+    int32 LightEntryStep = 0;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Combo")
+    int32 HeavyEntryStep = INDEX_NONE;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Combo", meta = (ClampMin = "1"))
+    int32 DefaultComboLength = 4;
+
+protected:
+    void AddComboTransitions(int32 LightNext, int32 HeavyNext, int32 NumSteps);
+
+protected:
+    TArray<int32> ComboTransitions;
+
+    TArray<FName> ComboSectionNames;
 };
\ No newline at end of file
@@ -0,0 +1,268 @@
+#include "SoulCombatSpatialSubsystem.h"
+#include "../Common/SoulStats.h"
+
+#include "GameFramework/Character.h"
+#include "Components/CapsuleComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("SpatialHash Update"), STAT_SoulSpatialHashUpdate, STATGROUP_Soul);
+DECLARE_CYCLE_STAT(TEXT("SpatialHash Query"), STAT_SoulSpatialHashQuery, STATGROUP_Soul);
+
+bool USoulCombatSpatialSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USoulCombatSpatialSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USoulCombatSpatialSubsystem, STATGROUP_Tickables);
+}
+
+FIntPoint USoulCombatSpatialSubsystem::ToCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+void USoulCombatSpatialSubsystem::RegisterCombatant(ACharacter* Combatant)
+{
+	if (!Combatant || EntryIndexByCharacter.Contains(Combatant))
+	{
+		return;
+	}
+
+	FSoulCombatantEntry Entry;
+	Entry.Character = Combatant;
+	Entry.Key = Combatant;
+	Entry.Location = Combatant->GetActorLocation();
+	UpdateCapsule(Entry, Combatant);
+
+	const int32 EntryIndex = Entries.Add(Entry);
+	EntryIndexByCharacter.Add(Combatant, EntryIndex);
+
+	AddToCell(EntryIndex, ToCell(Entry.Location));
+}
+
+void USoulCombatSpatialSubsystem::UnregisterCombatant(ACharacter* Combatant)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (EntryIndexByCharacter.RemoveAndCopyValue(Combatant, EntryIndex))
+	{
+		RemoveFromCell(EntryIndex);
+		Entries.RemoveAt(EntryIndex);
+	}
+}
+
+void USoulCombatSpatialSubsystem::UpdateCapsule(FSoulCombatantEntry& Entry, const ACharacter* Combatant)
+{
+	if (const UCapsuleComponent* Capsule = Combatant->GetCapsuleComponent())
+	{
+		Entry.Radius = Capsule->GetScaledCapsuleRadius();
+		Entry.HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+	}
+
+	MaxCombatantRadius = FMath::Max(MaxCombatantRadius, Entry.Radius);
+}
+
+void USoulCombatSpatialSubsystem::AddToCell(int32 EntryIndex, const FIntPoint& Cell)
+{
+	FSoulCombatantEntry& Entry = Entries[EntryIndex];
+	TArray<int32>& Bucket = Cells.FindOrAdd(Cell);
+
+	Entry.Cell = Cell;
+	Entry.IndexInCell = Bucket.Add(EntryIndex);
+}
+
+void USoulCombatSpatialSubsystem::RemoveFromCell(int32 EntryIndex)
+{
+	FSoulCombatantEntry& Entry = Entries[EntryIndex];
+
+	TArray<int32>* Bucket = Cells.Find(Entry.Cell);
+	if (!Bucket || !Bucket->IsValidIndex(Entry.IndexInCell))
+	{
+		return;
+	}
+
+	const int32 LastIndex = Bucket->Num() - 1;
+	if (Entry.IndexInCell != LastIndex)
+	{
+		const int32 MovedEntryIndex = (*Bucket)[LastIndex];
+		(*Bucket)[Entry.IndexInCell] = MovedEntryIndex;
+		Entries[MovedEntryIndex].IndexInCell = Entry.IndexInCell;
+	}
+
+	Bucket->Pop(EAllowShrinking::No);
+	Entry.IndexInCell = INDEX_NONE;
+}
+
+void USoulCombatSpatialSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_SoulSpatialHashUpdate);
+
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		FSoulCombatantEntry& Entry = *It;
+		const ACharacter* Character = Entry.Character.Get();
+
+		if (!Character)
+		{
+			EntryIndexByCharacter.Remove(Entry.Key);
+			RemoveFromCell(It.GetIndex());
+			It.RemoveCurrent();
+			continue;
+		}
+
+		Entry.Location = Character->GetActorLocation();
+		UpdateCapsule(Entry, Character);
+
+		// Buckets only change when the combatant crosses a cell boundary.
+		const FIntPoint NewCell = ToCell(Entry.Location);
+		if (NewCell != Entry.Cell)
+		{
+			RemoveFromCell(It.GetIndex());
+			AddToCell(It.GetIndex(), NewCell);
+		}
+	}
+}
+
+template<typename FunctorType>
+void USoulCombatSpatialSubsystem::ForEachInRadius(const FVector& Origin, float Radius, const AActor* Ignore, bool bTestTargetCapsule, FunctorType&& Functor) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_SoulSpatialHashQuery);
+
+	const float SearchRadius = bTestTargetCapsule ? Radius + MaxCombatantRadius : Radius;
+	const FIntPoint MinCell = ToCell(Origin - FVector(SearchRadius));
+	const FIntPoint MaxCell = ToCell(Origin + FVector(SearchRadius));
+
+	for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+	{
+		for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+		{
+			const TArray<int32>* Bucket = Cells.Find(FIntPoint(CellX, CellY));
+			if (!Bucket)
+			{
+				continue;
+			}
+
+			for (const int32 EntryIndex : *Bucket)
+			{
+				const FSoulCombatantEntry& Entry = Entries[EntryIndex];
+				const FVector TestPoint = bTestTargetCapsule ? Entry.ClosestAxisPoint(Origin) : Entry.Location;
+				const float DistSq = FVector::DistSquared(Origin, TestPoint);
+
+				if (DistSq > FMath::Square(bTestTargetCapsule ? Radius + Entry.Radius : Radius))
+				{
+					continue;
+				}
+
+				ACharacter* Character = Entry.Character.Get();
+				if (!Character || Character == Ignore)
+				{
+					continue;
+				}
+
+				if (!Functor(Character, Entry, DistSq))
+				{
+					return;
+				}
+			}
+		}
+	}
+}
+
+void USoulCombatSpatialSubsystem::QueryRadius(const FVector& Origin, float Radius, TArray<ACharacter*>& OutCombatants, const AActor* Ignore) const
+{
+	ForEachInRadius(Origin, Radius, Ignore, false, [&OutCombatants](ACharacter* Character, const FSoulCombatantEntry&, float)
+		{
+			OutCombatants.Add(Character);
+			return true;
+		});
+}
+
+void USoulCombatSpatialSubsystem::QueryCone(const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees, TArray<ACharacter*>& OutCombatants, const AActor* Ignore) const
+{
+	const FVector ConeDir = Direction.GetSafeNormal();
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(HalfAngleDegrees));
+
+	ForEachInRadius(Origin, Radius, Ignore, false, [&](ACharacter* Character, const FSoulCombatantEntry& Entry, float)
+		{
+			if (((Entry.Location - Origin).GetSafeNormal() | ConeDir) >= CosHalfAngle)
+			{
+				OutCombatants.Add(Character);
+			}
+			return true;
+		});
+}
+
+void USoulCombatSpatialSubsystem::QueryNearest(const FVector& Origin, float MaxRadius, int32 MaxCount, TArray<ACharacter*>& OutCombatants, const AActor* Ignore) const
+{
+	if (MaxCount <= 0)
+	{
+		return;
+	}
+
+	TArray<TPair<float, ACharacter*>, TInlineAllocator<32>> Candidates;
+
+	ForEachInRadius(Origin, MaxRadius, Ignore, true, [&Candidates](ACharacter* Character, const FSoulCombatantEntry&, float DistSq)
+		{
+			Candidates.Emplace(DistSq, Character);
+			return true;
+		});
+
+	Candidates.Sort([](const TPair<float, ACharacter*>& A, const TPair<float, ACharacter*>& B)
+		{
+			return A.Key < B.Key;
+		});
+
+	const int32 NumResults = FMath::Min(MaxCount, Candidates.Num());
+	for (int32 Index = 0; Index < NumResults; ++Index)
+	{
+		OutCombatants.Add(Candidates[Index].Value);
+	}
+}
+
+bool USoulCombatSpatialSubsystem::HasAnyInRadius(const FVector& Origin, float Radius, const AActor* Ignore, bool bTestTargetCapsule) const
+{
+	bool bFound = false;
+
+	ForEachInRadius(Origin, Radius, Ignore, bTestTargetCapsule, [&bFound](ACharacter*, const FSoulCombatantEntry&, float)
+		{
+			bFound = true;
+			return false;
+		});
+
+	return bFound;
+}
+
+bool USoulCombatSpatialSubsystem::HasAnyInCone(const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees, const AActor* Ignore, bool bTestTargetCapsule) const
+{
+	const FVector ConeDir = Direction.GetSafeNormal();
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(HalfAngleDegrees));
+	bool bFound = false;
+
+	ForEachInRadius(Origin, Radius, Ignore, bTestTargetCapsule, [&](ACharacter*, const FSoulCombatantEntry& Entry, float DistSq)
+		{
+			const FVector ToEntry = (bTestTargetCapsule ? Entry.ClosestAxisPoint(Origin) : Entry.Location) - Origin;
+			const float CosAngle = ToEntry.GetSafeNormal() | ConeDir;
+
+			if (!bTestTargetCapsule || Entry.Radius <= 0)
+			{
+				bFound = CosAngle >= CosHalfAngle;
+				return !bFound;
+			}
+
+			// Widen the cone by the angle the target sphere subtends at the origin.
+			const float Dist = FMath::Sqrt(DistSq);
+			if (Dist <= Entry.Radius)
+			{
+				bFound = true;
+				return false;
+			}
+
+			const float PaddedHalfAngle = HalfAngleDegrees + FMath::RadiansToDegrees(FMath::Asin(Entry.Radius / Dist));
+			bFound = PaddedHalfAngle >= 180 || CosAngle >= FMath::Cos(FMath::DegreesToRadians(PaddedHalfAngle));
+			return !bFound;
+		});
+
+	return bFound;
+}
\ No newline at end of file
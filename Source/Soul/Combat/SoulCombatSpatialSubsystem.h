@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "SoulCombatSpatialSubsystem.generated.h"
+
+class ACharacter;
+
+struct FSoulCombatantEntry
+{
+	TWeakObjectPtr<ACharacter> Character;
+	TObjectKey<ACharacter> Key;
+	FVector Location = FVector::ZeroVector;
+	float Radius = 0;
+	float HalfHeight = 0;
+	FIntPoint Cell = FIntPoint::ZeroValue;
+	int32 IndexInCell = INDEX_NONE;
+
+	// Closest point to Point on the upright capsule's axis segment.
+	FORCEINLINE FVector ClosestAxisPoint(const FVector& Point) const
+	{
+		const float AxisHalfLength = FMath::Max<float>(HalfHeight - Radius, 0);
+		return FVector(Location.X, Location.Y, FMath::Clamp<float>(Point.Z, Location.Z - AxisHalfLength, Location.Z + AxisHalfLength));
+	}
+};
+
+UCLASS()
+class SOUL_API USoulCombatSpatialSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterCombatant(ACharacter* Combatant);
+	void UnregisterCombatant(ACharacter* Combatant);
+
+	void QueryRadius(const FVector& Origin, float Radius, TArray<ACharacter*>& OutCombatants, const AActor* Ignore = nullptr) const;
+	void QueryCone(const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees, TArray<ACharacter*>& OutCombatants, const AActor* Ignore = nullptr) const;
+	// Distances are measured to each combatant's capsule so targets above or below the origin are not dropped.
+	void QueryNearest(const FVector& Origin, float MaxRadius, int32 MaxCount, TArray<ACharacter*>& OutCombatants, const AActor* Ignore = nullptr) const;
+
+	// With bTestTargetCapsule each combatant is tested against its capsule instead of its centre point.
+	bool HasAnyInRadius(const FVector& Origin, float Radius, const AActor* Ignore = nullptr, bool bTestTargetCapsule = false) const;
+	bool HasAnyInCone(const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees, const AActor* Ignore = nullptr, bool bTestTargetCapsule = false) const;
+
+	FORCEINLINE int32 GetNumCombatants() const { return Entries.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	FIntPoint ToCell(const FVector& Location) const;
+
+	void UpdateCapsule(FSoulCombatantEntry& Entry, const ACharacter* Combatant);
+
+	void AddToCell(int32 EntryIndex, const FIntPoint& Cell);
+	void RemoveFromCell(int32 EntryIndex);
+
+	template<typename FunctorType>
+	void ForEachInRadius(const FVector& Origin, float Radius, const AActor* Ignore, bool bTestTargetCapsule, FunctorType&& Functor) const;
+
+protected:
+	TSparseArray<FSoulCombatantEntry> Entries;
+
+	TMap<TObjectKey<ACharacter>, int32> EntryIndexByCharacter;
+
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	float CellSize = 500;
+
+	float MaxCombatantRadius = 0;
+};
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include "SoulDamageQueueSubsystem.h"
+#include "../Common/SoulStats.h"
+#include "../Character/SoulCombatCharacterBase.h"
+
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("DamageQueue Resolve"), STAT_SoulDamageQueueResolve, STATGROUP_Soul);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Events Queued"), STAT_SoulDamageEventsQueued, STATGROUP_Soul);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Targets Resolved"), STAT_SoulDamageTargetsResolved, STATGROUP_Soul);
+
+static TAutoConsoleVariable<bool> CVarSoulCoalesceDamage(
+	TEXT("soul.Combat.CoalesceDamage"),
+	true,
+	TEXT("If true, point damage is accumulated per target and resolved once per frame by the damage queue.\n")
+	TEXT("If false, damage is applied immediately."),
+	ECVF_Default);
+
+bool USoulDamageQueueSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USoulDamageQueueSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Resolve after physics so every hit queued by this frame's sweeps lands in a fixed order.
+	ResolveTickFunction.Subsystem = this;
+	ResolveTickFunction.bCanEverTick = true;
+	ResolveTickFunction.bStartWithTickEnabled = true;
+	ResolveTickFunction.TickGroup = TG_PostPhysics;
+	ResolveTickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void USoulDamageQueueSubsystem::Deinitialize()
+{
+	if (ResolveTickFunction.IsTickFunctionRegistered())
+	{
+		ResolveTickFunction.UnRegisterTickFunction();
+	}
+	ResolveTickFunction.Subsystem = nullptr;
+
+	Super::Deinitialize();
+}
+
+void FSoulDamageQueueTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem && !Subsystem->PendingDamage.IsEmpty())
+	{
+		Subsystem->ResolvePending();
+	}
+}
+
+FString FSoulDamageQueueTickFunction::DiagnosticMessage()
+{
+	return TEXT("USoulDamageQueueSubsystem::ResolvePending");
+}
+
+void USoulDamageQueueSubsystem::ApplyPointDamage(AActor* DamagedActor, float BaseDamage, const FVector& HitFromDirection, const FHitResult& HitInfo, AController* EventInstigator, AActor* DamageCauser)
+{
+	if (!DamagedActor || BaseDamage == 0)
+	{
+		return;
+	}
+
+	// Eligibility is decided when the hit lands, not when the queue flushes.
+	const ASoulCombatCharacterBase* SoulTarget = Cast<ASoulCombatCharacterBase>(DamagedActor);
+	if (SoulTarget && !SoulTarget->CanReceiveDamage())
+	{
+		return;
+	}
+
+	USoulDamageQueueSubsystem* DamageQueue = nullptr;
+	if (CVarSoulCoalesceDamage.GetValueOnGameThread())
+	{
+		if (UWorld* World = DamagedActor->GetWorld())
+		{
+			DamageQueue = World->GetSubsystem<USoulDamageQueueSubsystem>();
+		}
+	}
+
+	if (!DamageQueue)
+	{
+		UGameplayStatics::ApplyPointDamage(DamagedActor, BaseDamage, HitFromDirection, HitInfo, EventInstigator, DamageCauser, nullptr);
+		return;
+	}
+
+	DamageQueue->QueuePointDamage(DamagedActor, BaseDamage, HitFromDirection, HitInfo, EventInstigator, DamageCauser);
+}
+
+void USoulDamageQueueSubsystem::QueuePointDamage(AActor* DamagedActor, float BaseDamage, const FVector& HitFromDirection, const FHitResult& HitInfo, AController* EventInstigator, AActor* DamageCauser)
+{
+	INC_DWORD_STAT(STAT_SoulDamageEventsQueued);
+
+	int32& PendingIndex = PendingIndexByTarget.FindOrAdd(DamagedActor, INDEX_NONE);
+	if (PendingIndex == INDEX_NONE)
+	{
+		PendingIndex = PendingDamage.AddDefaulted();
+		PendingDamage[PendingIndex].Target = DamagedActor;
+	}
+
+	FSoulQueuedDamage& Entry = PendingDamage[PendingIndex];
+	Entry.TotalDamage += BaseDamage;
+
+	// Credit and hit direction follow the single largest hit; ties keep the earlier one.
+	if (BaseDamage > Entry.LargestHitDamage)
+	{
+		Entry.LargestHitDamage = BaseDamage;
+		Entry.EventInstigator = EventInstigator;
+		Entry.DamageCauser = DamageCauser;
+		Entry.HitFromDirection = HitFromDirection;
+		Entry.HitInfo = HitInfo;
+	}
+}
+
+void USoulDamageQueueSubsystem::ResolvePending()
+{
+	SCOPE_CYCLE_COUNTER(STAT_SoulDamageQueueResolve);
+
+	Swap(ResolvingDamage, PendingDamage);
+	PendingDamage.Reset();
+	PendingIndexByTarget.Reset();
+
+	INC_DWORD_STAT_BY(STAT_SoulDamageTargetsResolved, ResolvingDamage.Num());
+
+	TGuardValue<bool> ResolvingGuard(bResolving, true);
+
+	for (const FSoulQueuedDamage& Entry : ResolvingDamage)
+	{
+		AActor* Target = Entry.Target.Get();
+		if (!Target)
+		{
+			continue;
+		}
+
+		UGameplayStatics::ApplyPointDamage(Target, Entry.TotalDamage, Entry.HitFromDirection, Entry.HitInfo, Entry.EventInstigator.Get(), Entry.DamageCauser.Get(), nullptr);
+	}
+
+	ResolvingDamage.Reset();
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "UObject/ObjectKey.h"
+#include "SoulDamageQueueSubsystem.generated.h"
+
+class USoulDamageQueueSubsystem;
+
+struct FSoulQueuedDamage
+{
+	TWeakObjectPtr<AActor> Target;
+	TWeakObjectPtr<AController> EventInstigator;
+	TWeakObjectPtr<AActor> DamageCauser;
+	FVector HitFromDirection = FVector::ZeroVector;
+	FHitResult HitInfo;
+	float TotalDamage = 0;
+	float LargestHitDamage = 0;
+};
+
+struct FSoulDamageQueueTickFunction : public FTickFunction
+{
+	USoulDamageQueueSubsystem* Subsystem = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+UCLASS()
+class SOUL_API USoulDamageQueueSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	FORCEINLINE bool IsResolving() const { return bResolving; }
+
+	static void ApplyPointDamage(AActor* DamagedActor, float BaseDamage, const FVector& HitFromDirection, const FHitResult& HitInfo, AController* EventInstigator, AActor* DamageCauser);
+
+	void QueuePointDamage(AActor* DamagedActor, float BaseDamage, const FVector& HitFromDirection, const FHitResult& HitInfo, AController* EventInstigator, AActor* DamageCauser);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	void ResolvePending();
+
+	friend struct FSoulDamageQueueTickFunction;
+
+protected:
+	FSoulDamageQueueTickFunction ResolveTickFunction;
+
+	bool bResolving = false;
+
+	TArray<FSoulQueuedDamage> PendingDamage;
+
+	TArray<FSoulQueuedDamage> ResolvingDamage;
+
+	TMap<TObjectKey<AActor>, int32> PendingIndexByTarget;
+};
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include "SoulProjectileSubsystem.h"
+#include "../Character/SoulCharacter.h"
+#include "../Common/SoulStats.h"
+#include "SoulDamageQueueSubsystem.h"
+
+#include "GameFramework/Character.h"
+
+DECLARE_CYCLE_STAT(TEXT("Projectiles Integrate"), STAT_SoulProjectileIntegrate, STATGROUP_Soul);
+DECLARE_CYCLE_STAT(TEXT("Projectiles Trace"), STAT_SoulProjectileTrace, STATGROUP_Soul);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Live Projectiles"), STAT_SoulLiveProjectiles, STATGROUP_Soul);
+
+void USoulProjectileSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	ProjectileQueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(SoulProjectile), false);
+	ProjectileObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+	ProjectileObjectParams.AddObjectTypesToQuery(ECC_WorldStatic);
+	ProjectileObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+
+	Grow();
+}
+
+bool USoulProjectileSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USoulProjectileSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USoulProjectileSubsystem, STATGROUP_Tickables);
+}
+
+void USoulProjectileSubsystem::SpawnProjectile(const FVector& Origin, const FVector& Velocity, float GravityScale, float Lifetime, float Damage, ASoulCharacter* Instigator)
+{
+	if (NumLive == Positions.Num())
+	{
+		Grow();
+	}
+
+	const int32 Index = NumLive++;
+
+	Positions[Index] = Origin;
+	PrevPositions[Index] = Origin;
+	Velocities[Index] = Velocity;
+	GravityScales[Index] = GravityScale;
+	Lifetimes[Index] = Lifetime;
+	Damages[Index] = Damage;
+	Instigators[Index] = Instigator;
+}
+
+void USoulProjectileSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (NumLive == 0)
+	{
+		return;
+	}
+
+	Integrate(DeltaTime);
+	TraceSegments();
+
+	INC_DWORD_STAT_BY(STAT_SoulLiveProjectiles, NumLive);
+}
+
+void USoulProjectileSubsystem::Integrate(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SoulProjectileIntegrate);
+
+	const FVector::FReal GravityZ = GetWorld()->GetGravityZ() * DeltaTime;
+
+	FVector* RESTRICT Pos = Positions.GetData();
+	FVector* RESTRICT Prev = PrevPositions.GetData();
+	FVector* RESTRICT Vel = Velocities.GetData();
+	const float* RESTRICT Gravity = GravityScales.GetData();
+	float* RESTRICT Life = Lifetimes.GetData();
+
+	for (int32 Index = 0; Index < NumLive; ++Index)
+	{
+		Prev[Index] = Pos[Index];
+		Vel[Index].Z += GravityZ * Gravity[Index];
+		Pos[Index] += Vel[Index] * DeltaTime;
+		Life[Index] -= DeltaTime;
+	}
+}
+
+void USoulProjectileSubsystem::TraceSegments()
+{
+	SCOPE_CYCLE_COUNTER(STAT_SoulProjectileTrace);
+
+	UWorld* World = GetWorld();
+
+	for (int32 Index = NumLive - 1; Index >= 0; --Index)
+	{
+		FCollisionQueryParams Params = ProjectileQueryParams;
+		Params.AddIgnoredActor(Instigators[Index].Get());
+
+		FHitResult HitResult;
+		if (World->LineTraceSingleByObjectType(HitResult, PrevPositions[Index], Positions[Index], ProjectileObjectParams, Params))
+		{
+			ResolveHit(Index, HitResult);
+			Kill(Index);
+			continue;
+		}
+
+		if (Lifetimes[Index] <= 0)
+		{
+			Kill(Index);
+		}
+	}
+}
+
+void USoulProjectileSubsystem::ResolveHit(int32 Index, const FHitResult& HitResult)
+{
+	AActor* HitActor = HitResult.GetActor();
+	if (!HitActor || !HitActor->IsA<ACharacter>())
+	{
+		return;
+	}
+
+	ASoulCharacter* Instigator = Instigators[Index].Get();
+	const FVector Direction = Velocities[Index].GetSafeNormal();
+
+	USoulDamageQueueSubsystem::ApplyPointDamage(HitActor, Damages[Index], Direction, HitResult, Instigator ? Instigator->GetController() : nullptr, Instigator);
+}
+
+void USoulProjectileSubsystem::Grow()
+{
+	const int32 NewCapacity = FMath::Max(InitialCapacity, Positions.Num() * 2);
+
+	Positions.SetNumUninitialized(NewCapacity);
+	PrevPositions.SetNumUninitialized(NewCapacity);
+	Velocities.SetNumUninitialized(NewCapacity);
+	GravityScales.SetNumUninitialized(NewCapacity);
+	Lifetimes.SetNumUninitialized(NewCapacity);
+	Damages.SetNumUninitialized(NewCapacity);
+	Instigators.SetNum(NewCapacity);
+}
+
+void USoulProjectileSubsystem::Kill(int32 Index)
+{
+	const int32 Last = --NumLive;
+
+	if (Index != Last)
+	{
+		Positions[Index] = Positions[Last];
+		PrevPositions[Index] = PrevPositions[Last];
+		Velocities[Index] = Velocities[Last];
+		GravityScales[Index] = GravityScales[Last];
+		Lifetimes[Index] = Lifetimes[Last];
+		Damages[Index] = Damages[Last];
+		Instigators[Index] = Instigators[Last];
+	}
+
+	Instigators[Last].Reset();
+}
\ No newline at end of file
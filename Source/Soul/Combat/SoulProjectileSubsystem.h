@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SoulProjectileSubsystem.generated.h"
+
+class ASoulCharacter;
+
+UCLASS()
+class SOUL_API USoulProjectileSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void SpawnProjectile(const FVector& Origin, const FVector& Velocity, float GravityScale, float Lifetime, float Damage, ASoulCharacter* Instigator);
+
+	FORCEINLINE int32 GetNumLiveProjectiles() const { return NumLive; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	void Integrate(float DeltaTime);
+	void TraceSegments();
+	void ResolveHit(int32 Index, const FHitResult& HitResult);
+	void Grow();
+	void Kill(int32 Index);
+
+protected:
+	TArray<FVector> Positions;
+	TArray<FVector> PrevPositions;
+	TArray<FVector> Velocities;
+	TArray<float> GravityScales;
+	TArray<float> Lifetimes;
+	TArray<float> Damages;
+	TArray<TWeakObjectPtr<ASoulCharacter>> Instigators;
+
+	int32 NumLive = 0;
+
+	static constexpr int32 InitialCapacity = 256;
+
+	FCollisionQueryParams ProjectileQueryParams;
+
+	FCollisionObjectQueryParams ProjectileObjectParams;
+};
\ No newline at end of file
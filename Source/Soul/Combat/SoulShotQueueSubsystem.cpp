@@ -0,0 +1,134 @@
+#include "SoulShotQueueSubsystem.h"
+#include "../Character/SoulCharacter.h"
+#include "../Common/SoulStats.h"
+#include "../Common/SoulCombatTelemetry.h"
+#include "SoulDamageQueueSubsystem.h"
+
+#include "GameFramework/Character.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("ShotQueue Submit"), STAT_SoulShotQueueSubmit, STATGROUP_Soul);
+DECLARE_CYCLE_STAT(TEXT("ShotQueue Resolve"), STAT_SoulShotQueueResolve, STATGROUP_Soul);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Shots Submitted"), STAT_SoulShotsSubmitted, STATGROUP_Soul);
+
+static TAutoConsoleVariable<bool> CVarSoulDrawShotDebug(
+	TEXT("soul.Combat.DrawShotDebug"),
+	false,
+	TEXT("Draw a debug line for every resolved gun shot."),
+	ECVF_Cheat);
+
+namespace SoulShotQueue
+{
+	constexpr uint32 BufferBit = 1u << 31;
+}
+
+void USoulShotQueueSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	ShotTraceDelegate.BindUObject(this, &USoulShotQueueSubsystem::OnShotTraceCompleted);
+
+	ShotQueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(SoulGunShot), false);
+	ShotObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+}
+
+bool USoulShotQueueSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USoulShotQueueSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USoulShotQueueSubsystem, STATGROUP_Tickables);
+}
+
+void USoulShotQueueSubsystem::QueueShot(const FSoulShotRequest& Request)
+{
+	PendingShots.Add(Request);
+}
+
+void USoulShotQueueSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (PendingShots.IsEmpty())
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SoulShotQueueSubmit);
+	INC_DWORD_STAT_BY(STAT_SoulShotsSubmitted, PendingShots.Num());
+
+	UWorld* World = GetWorld();
+
+	SubmitBufferIndex ^= 1;
+	TArray<FSoulShotRequest>& InFlight = InFlightShots[SubmitBufferIndex];
+	InFlight = MoveTemp(PendingShots);
+	PendingShots.Reset();
+
+	const uint32 BufferTag = SubmitBufferIndex ? SoulShotQueue::BufferBit : 0;
+
+	for (int32 Index = 0; Index < InFlight.Num(); ++Index)
+	{
+		const FSoulShotRequest& Request = InFlight[Index];
+
+		FCollisionQueryParams Params = ShotQueryParams;
+		Params.AddIgnoredActor(Request.Instigator.Get());
+
+		const FVector End = Request.Origin + Request.Direction * Request.Range;
+		World->AsyncLineTraceByObjectType(EAsyncTraceType::Single, Request.Origin, End, ShotObjectParams, Params, &ShotTraceDelegate, BufferTag | (uint32)Index);
+	}
+}
+
+void USoulShotQueueSubsystem::OnShotTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SoulShotQueueResolve);
+
+	const TArray<FSoulShotRequest>& InFlight = InFlightShots[(TraceDatum.UserData & SoulShotQueue::BufferBit) ? 1 : 0];
+	const int32 Index = (int32)(TraceDatum.UserData & ~SoulShotQueue::BufferBit);
+
+	if (!InFlight.IsValidIndex(Index))
+	{
+		return;
+	}
+
+	const FHitResult* HitResult = nullptr;
+	for (const FHitResult& Hit : TraceDatum.OutHits)
+	{
+		if (Hit.bBlockingHit)
+		{
+			HitResult = &Hit;
+			break;
+		}
+	}
+
+#if ENABLE_DRAW_DEBUG
+	if (CVarSoulDrawShotDebug.GetValueOnGameThread())
+	{
+		DrawDebugLine(GetWorld(), TraceDatum.Start, TraceDatum.End, HitResult ? FColor::Green : FColor::Red, false, 1, 0, 1);
+	}
+#endif
+
+	ResolveShot(InFlight[Index], HitResult);
+}
+
+void USoulShotQueueSubsystem::ResolveShot(const FSoulShotRequest& Request, const FHitResult* HitResult)
+{
+	ASoulCharacter* Instigator = Request.Instigator.Get();
+
+	if (HitResult)
+	{
+		AActor* HitActor = HitResult->GetActor();
+		if (HitActor && HitActor->IsA<ACharacter>())
+		{
+			USoulDamageQueueSubsystem::ApplyPointDamage(HitActor, Request.Damage, Request.Direction, *HitResult, Instigator ? Instigator->GetController() : nullptr, Instigator);
+
+			FSoulCombatTelemetry::Record(ESoulCombatEvent::Hit, Instigator, HitActor, Request.Damage);
+		}
+	}
+
+	if (Instigator)
+	{
+		Instigator->OnGunShotResolved(HitResult);
+	}
+}
\ No newline at end of file
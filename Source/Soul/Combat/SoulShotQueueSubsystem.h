@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/World.h"
+#include "SoulShotQueueSubsystem.generated.h"
+
+class ASoulCharacter;
+
+struct FSoulShotRequest
+{
+	FVector Origin = FVector::ZeroVector;
+	FVector Direction = FVector::ForwardVector;
+	float Range = 0;
+	float Damage = 0;
+	TWeakObjectPtr<ASoulCharacter> Instigator;
+};
+
+UCLASS()
+class SOUL_API USoulShotQueueSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void QueueShot(const FSoulShotRequest& Request);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	void OnShotTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+	void ResolveShot(const FSoulShotRequest& Request, const FHitResult* HitResult);
+
+protected:
+	TArray<FSoulShotRequest> PendingShots;
+
+	TArray<FSoulShotRequest> InFlightShots[2];
+
+	uint32 SubmitBufferIndex = 0;
+
+	FTraceDelegate ShotTraceDelegate;
+
+	FCollisionQueryParams ShotQueryParams;
+
+	FCollisionObjectQueryParams ShotObjectParams;
+};
\ No newline at end of file
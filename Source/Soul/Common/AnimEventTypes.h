@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AnimEventTypes.generated.h"
+
+UENUM(BlueprintType)
+enum class ESoulAnimEvent : uint8
+{
+	NextAttackCheck   UMETA(DisplayName = "Next Attack Check"),
+	AttackHitCheck    UMETA(DisplayName = "Attack Hit Check"),
+	GunShot           UMETA(DisplayName = "Gun Shot"),
+	GunCanReShot      UMETA(DisplayName = "Gun Can ReShot"),
+	GunShotEnd        UMETA(DisplayName = "Gun Shot End"),
+	DodgeIFrameOn     UMETA(DisplayName = "Dodge IFrame On"),
+	DodgeIFrameOff    UMETA(DisplayName = "Dodge IFrame Off"),
+	DodgeEnd          UMETA(DisplayName = "Dodge End"),
+	LadderTopMountEnd UMETA(DisplayName = "Ladder Top Mount End"),
+	LadderTopExitEnd  UMETA(DisplayName = "Ladder Top Exit End"),
+	Count             UMETA(Hidden),
+};
+
+// Anim event handler tables are indexed by these values; append new events before Count and extend every table.
+static_assert((uint8)ESoulAnimEvent::NextAttackCheck == 0 && (uint8)ESoulAnimEvent::AttackHitCheck == 1
+	&& (uint8)ESoulAnimEvent::GunShot == 2 && (uint8)ESoulAnimEvent::GunCanReShot == 3
+	&& (uint8)ESoulAnimEvent::GunShotEnd == 4 && (uint8)ESoulAnimEvent::DodgeIFrameOn == 5
+	&& (uint8)ESoulAnimEvent::DodgeIFrameOff == 6 && (uint8)ESoulAnimEvent::DodgeEnd == 7
+	&& (uint8)ESoulAnimEvent::LadderTopMountEnd == 8 && (uint8)ESoulAnimEvent::LadderTopExitEnd == 9
+	&& (uint8)ESoulAnimEvent::Count == 10, "ESoulAnimEvent order is baked into the anim event handler tables");
\ No newline at end of file
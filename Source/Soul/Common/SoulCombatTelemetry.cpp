@@ -0,0 +1,304 @@
+#include "SoulCombatTelemetry.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+#include "Misc/CoreMisc.h"
+
+static TAutoConsoleVariable<bool> CVarSoulCombatTelemetry(
+	TEXT("soul.Combat.Telemetry"),
+	true,
+	TEXT("If true, combat events (hit, damage, death, swap, shot, state change) are recorded into the telemetry ring buffer."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarSoulCombatTelemetryFlushInterval(
+	TEXT("soul.Combat.TelemetryFlushInterval"),
+	0.5,
+	TEXT("Seconds between background flushes of the combat telemetry ring buffer to Saved/Telemetry."),
+	ECVF_Default);
+
+namespace SoulCombatTelemetry
+{
+	constexpr uint64 SequenceMask = FSoulCombatTelemetry::Capacity - 1;
+
+	static_assert((FSoulCombatTelemetry::Capacity & SequenceMask) == 0, "Telemetry capacity must be a power of two.");
+}
+
+const TCHAR* LexToString(ESoulCombatEvent Type)
+{
+	switch (Type)
+	{
+	case ESoulCombatEvent::Hit:
+		return TEXT("Hit");
+	case ESoulCombatEvent::Damage:
+		return TEXT("Damage");
+	case ESoulCombatEvent::Death:
+		return TEXT("Death");
+	case ESoulCombatEvent::Swap:
+		return TEXT("Swap");
+	case ESoulCombatEvent::Shot:
+		return TEXT("Shot");
+	case ESoulCombatEvent::StateChange:
+		return TEXT("StateChange");
+	}
+
+	return TEXT("Unknown");
+}
+
+class FSoulCombatTelemetryWriter : public FRunnable
+{
+public:
+	explicit FSoulCombatTelemetryWriter(FSoulCombatTelemetry& InTelemetry)
+		: Telemetry(InTelemetry)
+	{
+		WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+		Thread = FRunnableThread::Create(this, TEXT("SoulCombatTelemetryWriter"), 0, TPri_BelowNormal);
+	}
+
+	virtual ~FSoulCombatTelemetryWriter() override
+	{
+		if (Thread)
+		{
+			Thread->Kill(true);
+			delete Thread;
+			Thread = nullptr;
+		}
+
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+
+	virtual uint32 Run() override
+	{
+		while (!bStopping.load(std::memory_order_relaxed))
+		{
+			const float Interval = FMath::Max<float>(CVarSoulCombatTelemetryFlushInterval.GetValueOnAnyThread(), 0.05);
+			WakeEvent->Wait(FTimespan::FromSeconds(Interval));
+
+			Flush();
+		}
+
+		Flush();
+		FileHandle.Reset();
+
+		if (TotalDropped > 0)
+		{
+			UE_LOG(LogTemp, Log, TEXT("Combat telemetry dropped %llu events that were overwritten before they were flushed."), TotalDropped);
+		}
+
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bStopping.store(true, std::memory_order_relaxed);
+		WakeEvent->Trigger();
+	}
+
+private:
+	void Flush()
+	{
+		uint64 Dropped = 0;
+		Pending.Reset();
+		ReadCursor = Telemetry.Drain(ReadCursor, Pending, Dropped);
+		TotalDropped += Dropped;
+
+		if (Pending.IsEmpty() || !OpenFile())
+		{
+			return;
+		}
+
+		Line.Reset();
+		for (const FSoulCombatEventRecord& Event : Pending)
+		{
+			Line.Appendf(TEXT("%.4f,%llu,%s,%u,%u,%.2f,%.2f\n"), Event.Time, Event.Frame, LexToString(Event.Type), Event.SourceId, Event.TargetId, Event.Value, Event.Extra);
+		}
+
+		const FTCHARToUTF8 Utf8(*Line, Line.Len());
+		FileHandle->Write(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		FileHandle->Flush();
+	}
+
+	bool OpenFile()
+	{
+		if (FileHandle)
+		{
+			return true;
+		}
+
+		if (bOpenFailed)
+		{
+			return false;
+		}
+
+		const FString Directory = FPaths::ProjectSavedDir() / TEXT("Telemetry");
+		const FString FilePath = Directory / FString::Printf(TEXT("SoulCombat_%s.csv"), *FDateTime::Now().ToString());
+
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		PlatformFile.CreateDirectoryTree(*Directory);
+		FileHandle.Reset(PlatformFile.OpenWrite(*FilePath));
+
+		if (!FileHandle)
+		{
+			bOpenFailed = true;
+			return false;
+		}
+
+		const ANSICHAR Header[] = "Time,Frame,Event,Source,Target,Value,Extra\n";
+		FileHandle->Write(reinterpret_cast<const uint8*>(Header), sizeof(Header) - 1);
+		return true;
+	}
+
+private:
+	FSoulCombatTelemetry& Telemetry;
+
+	FRunnableThread* Thread = nullptr;
+	FEvent* WakeEvent = nullptr;
+	std::atomic<bool> bStopping { false };
+
+	TUniquePtr<IFileHandle> FileHandle;
+	bool bOpenFailed = false;
+
+	uint64 ReadCursor = 0;
+	uint64 TotalDropped = 0;
+	TArray<FSoulCombatEventRecord> Pending;
+	TStringBuilder<4096> Line;
+};
+
+FSoulCombatTelemetry& FSoulCombatTelemetry::Get()
+{
+	static FSoulCombatTelemetry Instance;
+	return Instance;
+}
+
+FSoulCombatTelemetry::~FSoulCombatTelemetry()
+{
+	StopWriter();
+}
+
+void FSoulCombatTelemetry::Record(ESoulCombatEvent Type, const UObject* Source, const UObject* Target, float Value, float Extra)
+{
+	if (!CVarSoulCombatTelemetry.GetValueOnAnyThread())
+	{
+		return;
+	}
+
+	FSoulCombatEventRecord Event;
+	Event.Time = FPlatformTime::Seconds();
+	Event.Frame = GFrameCounter;
+	Event.SourceId = Source ? Source->GetUniqueID() : 0;
+	Event.TargetId = Target ? Target->GetUniqueID() : 0;
+	Event.Value = Value;
+	Event.Extra = Extra;
+	Event.Type = Type;
+
+	Get().Push(Event);
+}
+
+void FSoulCombatTelemetry::Push(const FSoulCombatEventRecord& Event)
+{
+	const uint64 Sequence = WriteCursor.fetch_add(1, std::memory_order_relaxed);
+	FSlot& Slot = Slots[Sequence & SoulCombatTelemetry::SequenceMask];
+
+	Slot.Sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	Slot.Event = Event;
+	Slot.Sequence.store(Sequence + 1, std::memory_order_release);
+}
+
+bool FSoulCombatTelemetry::ReadSlot(uint64 Sequence, FSoulCombatEventRecord& OutEvent) const
+{
+	const FSlot& Slot = Slots[Sequence & SoulCombatTelemetry::SequenceMask];
+
+	if (Slot.Sequence.load(std::memory_order_acquire) != Sequence + 1)
+	{
+		return false;
+	}
+
+	OutEvent = Slot.Event;
+	std::atomic_thread_fence(std::memory_order_acquire);
+
+	return Slot.Sequence.load(std::memory_order_relaxed) == Sequence + 1;
+}
+
+uint64 FSoulCombatTelemetry::Drain(uint64 FromSequence, TArray<FSoulCombatEventRecord>& OutEvents, uint64& OutDropped) const
+{
+	const uint64 Head = WriteCursor.load(std::memory_order_acquire);
+
+	OutDropped = 0;
+	if (Head - FromSequence > Capacity)
+	{
+		OutDropped = Head - Capacity - FromSequence;
+		FromSequence = Head - Capacity;
+	}
+
+	FSoulCombatEventRecord Event;
+	for (uint64 Sequence = FromSequence; Sequence < Head; ++Sequence)
+	{
+		if (ReadSlot(Sequence, Event))
+		{
+			OutEvents.Add(Event);
+			continue;
+		}
+
+		const uint64 Published = Slots[Sequence & SoulCombatTelemetry::SequenceMask].Sequence.load(std::memory_order_acquire);
+		if (Published <= Sequence)
+		{
+			return Sequence;
+		}
+
+		++OutDropped;
+	}
+
+	return Head;
+}
+
+void FSoulCombatTelemetry::CopyRecent(int32 MaxCount, TArray<FSoulCombatEventRecord>& OutEvents) const
+{
+	const uint64 Head = WriteCursor.load(std::memory_order_acquire);
+	const uint64 Count = FMath::Min<uint64>(FMath::Min<uint64>(FMath::Max(MaxCount, 0), Capacity), Head);
+
+	FSoulCombatEventRecord Event;
+	for (uint64 Sequence = Head - Count; Sequence < Head; ++Sequence)
+	{
+		if (ReadSlot(Sequence, Event))
+		{
+			OutEvents.Add(Event);
+		}
+	}
+}
+
+void FSoulCombatTelemetry::StartWriter()
+{
+	if (Writer || IsRunningCommandlet() || !FPlatformProcess::SupportsMultithreading())
+	{
+		return;
+	}
+
+	Writer = MakeUnique<FSoulCombatTelemetryWriter>(*this);
+}
+
+void FSoulCombatTelemetry::StopWriter()
+{
+	Writer.Reset();
+}
+
+static FAutoConsoleCommand CmdSoulDumpCombatTelemetry(
+	TEXT("soul.Combat.DumpTelemetry"),
+	TEXT("Prints the most recent combat telemetry events. Usage: soul.Combat.DumpTelemetry [Count=32]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const int32 Count = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 32;
+
+			TArray<FSoulCombatEventRecord> Events;
+			FSoulCombatTelemetry::Get().CopyRecent(Count, Events);
+
+			for (const FSoulCombatEventRecord& Event : Events)
+			{
+				UE_LOG(LogTemp, Log, TEXT("%.4f | Frame %llu | %s | Source %u | Target %u | %.2f | %.2f"), Event.Time, Event.Frame, LexToString(Event.Type), Event.SourceId, Event.TargetId, Event.Value, Event.Extra);
+			}
+		}));
\ No newline at end of file
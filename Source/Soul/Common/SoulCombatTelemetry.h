@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+class FSoulCombatTelemetryWriter;
+
+enum class ESoulCombatEvent : uint8
+{
+	Hit,
+	Damage,
+	Death,
+	Swap,
+	Shot,
+	StateChange
+};
+
+SOUL_API const TCHAR* LexToString(ESoulCombatEvent Type);
+
+struct FSoulCombatEventRecord
+{
+	double Time = 0;
+	uint64 Frame = 0;
+	uint32 SourceId = 0;
+	uint32 TargetId = 0;
+	float Value = 0;
+	float Extra = 0;
+	ESoulCombatEvent Type = ESoulCombatEvent::Hit;
+};
+
+class SOUL_API FSoulCombatTelemetry
+{
+public:
+	static constexpr uint64 Capacity = 8192;
+
+	static FSoulCombatTelemetry& Get();
+
+	static void Record(ESoulCombatEvent Type, const UObject* Source, const UObject* Target, float Value = 0, float Extra = 0);
+
+	void Push(const FSoulCombatEventRecord& Event);
+
+	uint64 Drain(uint64 FromSequence, TArray<FSoulCombatEventRecord>& OutEvents, uint64& OutDropped) const;
+
+	void CopyRecent(int32 MaxCount, TArray<FSoulCombatEventRecord>& OutEvents) const;
+
+	void StartWriter();
+	void StopWriter();
+
+	~FSoulCombatTelemetry();
+
+private:
+	FSoulCombatTelemetry() = default;
+
+	bool ReadSlot(uint64 Sequence, FSoulCombatEventRecord& OutEvent) const;
+
+private:
+	struct FSlot
+	{
+		std::atomic<uint64> Sequence { 0 };
+		FSoulCombatEventRecord Event;
+	};
+
+	FSlot Slots[Capacity];
+
+	std::atomic<uint64> WriteCursor { 0 };
+
+	TUniquePtr<FSoulCombatTelemetryWriter> Writer;
+};
\ No newline at end of file
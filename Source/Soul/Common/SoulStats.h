@@ -0,0 +1,6 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("Soul"), STATGROUP_Soul, STATCAT_Advanced);
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StatTypes.generated.h"
+
+UENUM(BlueprintType)
+enum class ESoulDerivedStat : uint8
+{
+	MaxHP      UMETA(DisplayName = "Max HP"),
+	MaxStamina UMETA(DisplayName = "Max Stamina"),
+	Count      UMETA(Hidden),
+};
+
+UENUM(BlueprintType)
+enum class ESoulStatModifierOp : uint8
+{
+	Additive       UMETA(DisplayName = "Additive"),
+	Multiplicative UMETA(DisplayName = "Multiplicative"),
+	Override       UMETA(DisplayName = "Override"),
+};
+
+USTRUCT(BlueprintType)
+struct FSoulStatModifier
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats")
+	ESoulDerivedStat Stat = ESoulDerivedStat::MaxHP;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats")
+	ESoulStatModifierOp Op = ESoulStatModifierOp::Additive;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats")
+	float Value = 0;
+};
\ No newline at end of file
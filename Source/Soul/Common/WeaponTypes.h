@@ -8,4 +8,19 @@ enum class EWeaponType : uint8
 	Empty UMETA(DisplayName = "Empty"),
 	Sword UMETA(DisplayName = "Sword"),
 	Gun   UMETA(DisplayName = "Gun"),
+};
+
+UENUM(BlueprintType)
+enum class EGunFireMode : uint8
+{
+	Hitscan    UMETA(DisplayName = "Hitscan"),
+	Projectile UMETA(DisplayName = "Projectile"),
+};
+
+UENUM(BlueprintType)
+enum class ESoulComboInput : uint8
+{
+	Light UMETA(DisplayName = "Light"),
+	Heavy UMETA(DisplayName = "Heavy"),
+	Count UMETA(Hidden),
 };
\ No newline at end of file
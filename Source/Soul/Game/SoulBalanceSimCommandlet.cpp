@@ -0,0 +1,288 @@
+#include "SoulBalanceSimCommandlet.h"
+#include "../Character/SoulCharacterStatComponent.h"
+#include "../Character/SoulProgressionData.h"
+
+#include "Async/ParallelFor.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformTime.h"
+
+static const double SoulBalancePercentiles[] = { 0.1, 0.5, 0.9, 0.99 };
+static const TCHAR* SoulBalancePercentileNames[] = { TEXT("P10"), TEXT("P50"), TEXT("P90"), TEXT("P99") };
+
+USoulBalanceSimCommandlet::USoulBalanceSimCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 USoulBalanceSimCommandlet::Main(const FString& Params)
+{
+	FSimConfig Config;
+	ParseConfig(Params, Config);
+
+	USoulCharacterStatComponent* Template = NewObject<USoulCharacterStatComponent>(GetTransientPackage());
+
+	FString ProgressionPath;
+	if (FParse::Value(*Params, TEXT("Progression="), ProgressionPath))
+	{
+		Template->ProgressionData = LoadObject<USoulProgressionData>(nullptr, *ProgressionPath);
+		if (!Template->ProgressionData)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Balance sim could not load progression data '%s'."), *ProgressionPath);
+			return 1;
+		}
+	}
+
+	FParse::Value(*Params, TEXT("BaseInvestCost="), Template->BaseInvestCost);
+	FParse::Value(*Params, TEXT("CostMultiplier="), Template->CostMultiplier);
+	FParse::Value(*Params, TEXT("HPBase="), Template->HP_Base);
+	FParse::Value(*Params, TEXT("HPPerVIT="), Template->HP_PerVIT);
+	FParse::Value(*Params, TEXT("StaminaBase="), Template->Stamina_Base);
+	FParse::Value(*Params, TEXT("StaminaPerEND="), Template->Stamina_PerEND);
+
+	FSimTables Tables;
+	BuildTables(*Template, Config, Tables);
+
+	const int32 StepsPerSample = FMath::Max(1, FMath::RoundToInt(Config.SampleMinutes * 60 / Config.StepSeconds));
+	const int32 NumSamples = FMath::Max(1, FMath::CeilToInt(Config.Hours * 60 / Config.SampleMinutes));
+
+	// Two batches per logical core keeps workers busy while histogram memory stays bounded regardless of run count.
+	const int32 NumBatches = FMath::Clamp(FPlatformMisc::NumberOfCoresIncludingHyperthreads() * 2, 1, Config.Runs);
+	const int32 RunsPerBatch = FMath::DivideAndRoundUp(Config.Runs, NumBatches);
+
+	TArray<FBatchResult> BatchResults;
+	BatchResults.SetNum(NumBatches);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	ParallelFor(NumBatches, [&](int32 Batch)
+	{
+		const int32 FirstRun = Batch * RunsPerBatch;
+		const int32 NumRuns = FMath::Min(RunsPerBatch, Config.Runs - FirstRun);
+		SimulateBatch(Config, Tables, FirstRun, NumRuns, NumSamples, StepsPerSample, BatchResults[Batch]);
+	});
+
+	FBatchResult& Merged = BatchResults[0];
+	for (int32 Batch = 1; Batch < NumBatches; ++Batch)
+	{
+		Merged.Level.Merge(BatchResults[Batch].Level);
+		Merged.MaxHP.Merge(BatchResults[Batch].MaxHP);
+		Merged.MaxStamina.Merge(BatchResults[Batch].MaxStamina);
+	}
+
+	const double Elapsed = FPlatformTime::Seconds() - StartTime;
+
+	FString OutPath = FPaths::ProjectSavedDir() / TEXT("Balance") / TEXT("BalanceSim.csv");
+	FParse::Value(*Params, TEXT("Out="), OutPath);
+
+	if (!WriteCsv(OutPath, Config, NumSamples, Merged))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Balance sim failed to write '%s'."), *OutPath);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Balance sim: %d runs x %.1f h in %.2f s on %d batches -> %s"), Config.Runs, Config.Hours, Elapsed, NumBatches, *OutPath);
+	return 0;
+}
+
+void USoulBalanceSimCommandlet::ParseConfig(const FString& Params, FSimConfig& OutConfig)
+{
+	FParse::Value(*Params, TEXT("Runs="), OutConfig.Runs);
+	FParse::Value(*Params, TEXT("Hours="), OutConfig.Hours);
+	FParse::Value(*Params, TEXT("StepSeconds="), OutConfig.StepSeconds);
+	FParse::Value(*Params, TEXT("SampleMinutes="), OutConfig.SampleMinutes);
+	FParse::Value(*Params, TEXT("SoulsPerMinute="), OutConfig.SoulsPerMinute);
+	FParse::Value(*Params, TEXT("SoulsGrowthPerHour="), OutConfig.SoulsGrowthPerHour);
+	FParse::Value(*Params, TEXT("DeathChance="), OutConfig.DeathChancePerStep);
+	FParse::Value(*Params, TEXT("MaxAttribute="), OutConfig.MaxAttribute);
+	FParse::Value(*Params, TEXT("Seed="), OutConfig.Seed);
+
+	OutConfig.Runs = FMath::Max(1, OutConfig.Runs);
+	OutConfig.Hours = FMath::Max<float>(OutConfig.Hours, 0.1);
+	OutConfig.StepSeconds = FMath::Max<float>(OutConfig.StepSeconds, 1);
+	OutConfig.SampleMinutes = FMath::Max<float>(OutConfig.SampleMinutes, OutConfig.StepSeconds / 60);
+	OutConfig.DeathChancePerStep = FMath::Clamp<float>(OutConfig.DeathChancePerStep, 0, 1);
+	OutConfig.MaxAttribute = FMath::Max(1, OutConfig.MaxAttribute);
+}
+
+void USoulBalanceSimCommandlet::BuildTables(const USoulCharacterStatComponent& Template, const FSimConfig& Config, FSimTables& OutTables)
+{
+	OutTables.StartAttributes[0] = FMath::Clamp(Template.STR, 1, Config.MaxAttribute);
+	OutTables.StartAttributes[1] = FMath::Clamp(Template.DEX, 1, Config.MaxAttribute);
+	OutTables.StartAttributes[2] = FMath::Clamp(Template.VIT, 1, Config.MaxAttribute);
+	OutTables.StartAttributes[3] = FMath::Clamp(Template.END, 1, Config.MaxAttribute);
+	OutTables.StartSouls = Template.Souls;
+	OutTables.StartInvestCount = Template.InvestCount;
+
+	// Every invest raises one attribute, so the attribute cap bounds the invest count.
+	const int32 MaxInvests = Template.InvestCount + 4 * Config.MaxAttribute;
+	OutTables.InvestCost.SetNumUninitialized(MaxInvests + 1);
+	for (int32 Count = 0; Count <= MaxInvests; ++Count)
+	{
+		OutTables.InvestCost[Count] = Template.GetInvestCost(Count);
+	}
+
+	OutTables.MaxHPByVIT.SetNumUninitialized(Config.MaxAttribute + 1);
+	OutTables.MaxStaminaByEND.SetNumUninitialized(Config.MaxAttribute + 1);
+	for (int32 Level = 0; Level <= Config.MaxAttribute; ++Level)
+	{
+		OutTables.MaxHPByVIT[Level] = Template.GetDerivedStatBaseAt(ESoulDerivedStat::MaxHP, Level);
+		OutTables.MaxStaminaByEND[Level] = Template.GetDerivedStatBaseAt(ESoulDerivedStat::MaxStamina, Level);
+	}
+}
+
+void USoulBalanceSimCommandlet::SimulateBatch(const FSimConfig& Config, const FSimTables& Tables, int32 FirstRun, int32 NumRuns, int32 NumSamples, int32 StepsPerSample, FBatchResult& OutResult)
+{
+	const float MaxHP = FMath::Max(Tables.MaxHPByVIT[Config.MaxAttribute], Tables.MaxHPByVIT[0]);
+	const float MaxStamina = FMath::Max(Tables.MaxStaminaByEND[Config.MaxAttribute], Tables.MaxStaminaByEND[0]);
+
+	OutResult.Level.Init(NumSamples, 4 * Config.MaxAttribute + 1, 1, true);
+	OutResult.MaxHP.Init(NumSamples, 512, FMath::Max<float>(MaxHP / 511, 1), false);
+	OutResult.MaxStamina.Init(NumSamples, 512, FMath::Max<float>(MaxStamina / 511, 1), false);
+
+	const int32 MaxInvestIndex = Tables.InvestCost.Num() - 1;
+	const float StepMinutes = Config.StepSeconds / 60;
+
+	for (int32 Run = FirstRun; Run < FirstRun + NumRuns; ++Run)
+	{
+		FRandomStream Random(Config.Seed + Run);
+
+		int32 Attributes[4] = { Tables.StartAttributes[0], Tables.StartAttributes[1], Tables.StartAttributes[2], Tables.StartAttributes[3] };
+		int64 Souls = Tables.StartSouls;
+		int32 InvestCount = Tables.StartInvestCount;
+
+		// Each run is one build archetype: a random weighting over the four attributes.
+		float Weights[4];
+		for (float& Weight : Weights)
+		{
+			Weight = Random.FRand() + 0.05;
+		}
+
+		int32 Step = 0;
+		for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+		{
+			for (int32 SubStep = 0; SubStep < StepsPerSample; ++SubStep, ++Step)
+			{
+				if (Random.FRand() < Config.DeathChancePerStep)
+				{
+					Souls = 0;
+					continue;
+				}
+
+				const float Hours = Step * Config.StepSeconds / 3600;
+				Souls += FMath::RoundToInt(Config.SoulsPerMinute * StepMinutes * (1 + Config.SoulsGrowthPerHour * Hours) * Random.FRandRange(0.5, 1.5));
+
+				while (InvestCount < MaxInvestIndex && Souls >= Tables.InvestCost[InvestCount])
+				{
+					// Capped attributes drop out of the draw so their weight is not handed to a neighbour.
+					float EligibleWeight = 0;
+					for (int32 Index = 0; Index < 4; ++Index)
+					{
+						EligibleWeight += (Attributes[Index] < Config.MaxAttribute) ? Weights[Index] : 0;
+					}
+
+					if (EligibleWeight <= 0)
+					{
+						break;
+					}
+
+					float Pick = Random.FRand() * EligibleWeight;
+					int32 Stat = INDEX_NONE;
+					for (int32 Index = 0; Index < 4; ++Index)
+					{
+						if (Attributes[Index] < Config.MaxAttribute)
+						{
+							Stat = Index;
+							Pick -= Weights[Index];
+							if (Pick <= 0)
+							{
+								break;
+							}
+						}
+					}
+
+					Souls -= Tables.InvestCost[InvestCount];
+					++InvestCount;
+					++Attributes[Stat];
+				}
+			}
+
+			OutResult.Level.Add(Sample, (float)(Attributes[0] + Attributes[1] + Attributes[2] + Attributes[3]));
+			OutResult.MaxHP.Add(Sample, Tables.MaxHPByVIT[Attributes[2]]);
+			OutResult.MaxStamina.Add(Sample, Tables.MaxStaminaByEND[Attributes[3]]);
+		}
+	}
+}
+
+bool USoulBalanceSimCommandlet::WriteCsv(const FString& Path, const FSimConfig& Config, int32 NumSamples, const FBatchResult& Result)
+{
+	FString Csv = TEXT("Minutes");
+	for (const TCHAR* Prefix : { TEXT("Level"), TEXT("MaxHP"), TEXT("MaxStamina") })
+	{
+		for (const TCHAR* Name : SoulBalancePercentileNames)
+		{
+			Csv += FString::Printf(TEXT(",%s_%s"), Prefix, Name);
+		}
+	}
+	Csv += LINE_TERMINATOR;
+
+	const uint64 Total = (uint64)Config.Runs;
+	for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+	{
+		Csv += FString::Printf(TEXT("%.1f"), (Sample + 1) * Config.SampleMinutes);
+		for (const FHistogram* Histogram : { &Result.Level, &Result.MaxHP, &Result.MaxStamina })
+		{
+			for (const double Fraction : SoulBalancePercentiles)
+			{
+				Csv += FString::Printf(TEXT(",%.1f"), Histogram->Percentile(Sample, Fraction, Total));
+			}
+		}
+		Csv += LINE_TERMINATOR;
+	}
+
+	return FFileHelper::SaveStringToFile(Csv, *Path);
+}
+
+void USoulBalanceSimCommandlet::FHistogram::Init(int32 NumSamples, int32 InNumBins, float InBinSize, bool bInDiscrete)
+{
+	BinSize = InBinSize;
+	bDiscrete = bInDiscrete;
+	NumBins = FMath::Max(1, InNumBins);
+	Counts.SetNumZeroed(NumSamples * NumBins);
+}
+
+void USoulBalanceSimCommandlet::FHistogram::Merge(const FHistogram& Other)
+{
+	check(Counts.Num() == Other.Counts.Num());
+	for (int32 Index = 0; Index < Counts.Num(); ++Index)
+	{
+		Counts[Index] += Other.Counts[Index];
+	}
+}
+
+float USoulBalanceSimCommandlet::FHistogram::Percentile(int32 Sample, double Fraction, uint64 Total) const
+{
+	const uint64 Target = FMath::Max<uint64>(1, (uint64)FMath::CeilToDouble(Fraction * (double)Total));
+
+	// Continuous histograms interpolate inside the bin that crosses the target rank.
+	uint64 Running = 0;
+	for (int32 Bin = 0; Bin < NumBins; ++Bin)
+	{
+		const uint32 BinCount = Counts[Sample * NumBins + Bin];
+		if (Running + BinCount >= Target && BinCount > 0)
+		{
+			if (bDiscrete)
+			{
+				return Bin * BinSize;
+			}
+
+			const double BinFraction = (double)(Target - Running) / BinCount;
+			return (Bin + BinFraction) * BinSize;
+		}
+		Running += BinCount;
+	}
+	return (bDiscrete ? NumBins - 1 : NumBins) * BinSize;
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SoulBalanceSimCommandlet.generated.h"
+
+class USoulCharacterStatComponent;
+
+// Usage: UnrealEditor-Cmd Soul -run=SoulBalanceSim -nullrhi [-Runs=1000000] [-Hours=20] [-Out=Path.csv]
+UCLASS()
+class SOUL_API USoulBalanceSimCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USoulBalanceSimCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+	struct FSimConfig
+	{
+		int32 Runs = 1000000;
+		float Hours = 20;
+		float StepSeconds = 60;
+		float SampleMinutes = 10;
+		float SoulsPerMinute = 150;
+		float SoulsGrowthPerHour = 0.15;
+		float DeathChancePerStep = 0.03;
+		int32 MaxAttribute = 99;
+		int32 Seed = 1337;
+	};
+
+	struct FSimTables
+	{
+		int32 StartAttributes[4] = { 1, 1, 1, 1 };
+		int32 StartSouls = 0;
+		int32 StartInvestCount = 0;
+
+		TArray<int32> InvestCost;
+		TArray<float> MaxHPByVIT;
+		TArray<float> MaxStaminaByEND;
+	};
+
+	struct FHistogram
+	{
+		float BinSize = 1;
+		int32 NumBins = 0;
+		// Integer-valued samples (e.g. level) report the bin value instead of interpolating.
+		bool bDiscrete = false;
+		TArray<uint32> Counts;
+
+		void Init(int32 NumSamples, int32 InNumBins, float InBinSize, bool bInDiscrete);
+		FORCEINLINE void Add(int32 Sample, float Value)
+		{
+			const int32 Bin = FMath::Clamp((int32)(Value / BinSize), 0, NumBins - 1);
+			++Counts[Sample * NumBins + Bin];
+		}
+		void Merge(const FHistogram& Other);
+		float Percentile(int32 Sample, double Fraction, uint64 Total) const;
+	};
+
+	struct FBatchResult
+	{
+		FHistogram Level;
+		FHistogram MaxHP;
+		FHistogram MaxStamina;
+	};
+
+	static void ParseConfig(const FString& Params, FSimConfig& OutConfig);
+	static void BuildTables(const USoulCharacterStatComponent& Template, const FSimConfig& Config, FSimTables& OutTables);
+	static void SimulateBatch(const FSimConfig& Config, const FSimTables& Tables, int32 FirstRun, int32 NumRuns, int32 NumSamples, int32 StepsPerSample, FBatchResult& OutResult);
+	static bool WriteCsv(const FString& Path, const FSimConfig& Config, int32 NumSamples, const FBatchResult& Result);
+};
\ No newline at end of file
@@ -1,8 +1,11 @@
 #include "SoulPlayerController.h"
 #include "../UI/CrosshairWidget.h"
 #include "../UI/InteractPromptWidget.h"
+#include "../UI/SoulDamageNumberSubsystem.h"
+#include "../UI/SSoulDamageNumberOverlay.h"
 
 #include "Blueprint/UserWidget.h"
+#include "Engine/GameViewportClient.h"
 
 void ASoulPlayerController::BeginPlay()
 {
@@ -17,6 +20,50 @@ void ASoulPlayerController::BeginPlay()
             CrosshairWidget->SetVisibility(ESlateVisibility::Hidden);
         }
     }
+
+    AddDamageNumberOverlay();
+}
+
+void ASoulPlayerController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    RemoveDamageNumberOverlay();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void ASoulPlayerController::AddDamageNumberOverlay()
+{
+    if (!IsLocalController() || DamageNumberOverlay.IsValid())
+    {
+        return;
+    }
+
+    UGameViewportClient* ViewportClient = GetWorld()->GetGameViewport();
+    if (!ViewportClient)
+    {
+        return;
+    }
+
+    DamageNumberOverlay = SNew(SSoulDamageNumberOverlay)
+        .OwningPlayer(this)
+        .DamageNumbers(GetWorld()->GetSubsystem<USoulDamageNumberSubsystem>());
+
+    ViewportClient->AddViewportWidgetContent(DamageNumberOverlay.ToSharedRef(), 5);
+}
+
+void ASoulPlayerController::RemoveDamageNumberOverlay()
+{
+    if (!DamageNumberOverlay.IsValid())
+    {
+        return;
+    }
+
+    if (UGameViewportClient* ViewportClient = GetWorld()->GetGameViewport())
+    {
+        ViewportClient->RemoveViewportWidgetContent(DamageNumberOverlay.ToSharedRef());
+    }
+
+    DamageNumberOverlay.Reset();
 }
 
 void ASoulPlayerController::ShowCrosshair(bool bShow)
@@ -7,6 +7,7 @@
 class UUserWidget;
 class UCrosshairWidget;
 class UInteractPromptWidget;
+class SSoulDamageNumberOverlay;
 
 UCLASS()
 class SOUL_API ASoulPlayerController : public APlayerController
@@ -24,7 +25,11 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
-	
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	void AddDamageNumberOverlay();
+	void RemoveDamageNumberOverlay();
+
 protected:
 	UPROPERTY(EditDefaultsOnly, Category = "UI")
 	TSubclassOf<UCrosshairWidget> CrosshairWidgetClass;
@@ -37,4 +42,6 @@ protected:
 
 	UPROPERTY()
 	TObjectPtr<UInteractPromptWidget> InteractPromptWidget;
+
+	TSharedPtr<SSoulDamageNumberOverlay> DamageNumberOverlay;
 };
@@ -3,6 +3,7 @@
 
 #include "Components/ArrowComponent.h"
 #include "Components/BoxComponent.h"
+#include "Components/SplineComponent.h"
 
 ASoulLadderActor::ASoulLadderActor()
 {
@@ -44,6 +45,10 @@ ASoulLadderActor::ASoulLadderActor()
     TopMountStartPoint = CreateDefaultSubobject<USceneComponent>(TEXT("TopMountStartPoint"));
     TopMountStartPoint->SetupAttachment(LadderMesh);
     TopMountStartPoint->SetRelativeLocation(FVector(0, 0, 240));
+
+    RailSpline = CreateDefaultSubobject<USplineComponent>(TEXT("RailSpline"));
+    RailSpline->SetupAttachment(LadderMesh);
+    RailSpline->SetSplinePoints({ FVector(0, 0, 0), FVector(0, 0, 220) }, ESplineCoordinateSpace::Local);
 }
 
 void ASoulLadderActor::BeginPlay()
@@ -55,6 +60,130 @@ void ASoulLadderActor::BeginPlay()
 
     TopInteractBox->OnComponentBeginOverlap.AddDynamic(this, &ASoulLadderActor::OnTopBeginOverlap);
     TopInteractBox->OnComponentEndOverlap.AddDynamic(this, &ASoulLadderActor::OnTopEndOverlap);
+
+    BakeRail();
+    Root->TransformUpdated.AddUObject(this, &ASoulLadderActor::OnRootTransformUpdated);
+}
+
+void ASoulLadderActor::OnRootTransformUpdated(USceneComponent*, EUpdateTransformFlags, ETeleportType)
+{
+    BakeRail();
+}
+
+void ASoulLadderActor::BakeRail()
+{
+    Rail.SnapLocations.Reset();
+    Rail.Facings.Reset();
+
+    if (bUseRailSpline && RailSpline && RailSpline->GetSplineLength() > KINDA_SMALL_NUMBER)
+    {
+        BakeSplineRail();
+    }
+    else
+    {
+        BakeStraightRail();
+    }
+
+    Rail.SampleSpacing = Rail.Length / (Rail.SnapLocations.Num() - 1);
+
+    Rail.TopMountStartLocation = TopMountStartPoint ? TopMountStartPoint->GetComponentLocation() : GetActorLocation();
+    Rail.TopMountStartRotation = GetForward().Rotation();
+}
+
+void ASoulLadderActor::BakeStraightRail()
+{
+    const FVector Forward = GetForward();
+
+    const float BottomZ = BottomPoint ? BottomPoint->GetComponentLocation().Z : GetActorLocation().Z;
+    const float TopZ = TopPoint ? TopPoint->GetComponentLocation().Z : GetActorLocation().Z + 300;
+
+    const FVector ActorLoc = GetActorLocation();
+    AddRailSample(FVector(ActorLoc.X, ActorLoc.Y, FMath::Min(BottomZ, TopZ)), Forward);
+    AddRailSample(FVector(ActorLoc.X, ActorLoc.Y, FMath::Max(BottomZ, TopZ)), Forward);
+
+    Rail.Length = FMath::Abs(TopZ - BottomZ);
+
+    Rail.TopExitLocation = TopPoint->GetComponentLocation() + Forward * ExitForwardDistance;
+    Rail.BottomExitLocation = BottomPoint->GetComponentLocation() + Forward * BottomExitForwardDistance;
+}
+
+void ASoulLadderActor::BakeSplineRail()
+{
+    const FVector LadderForwardDir = GetForward();
+    const float SplineLength = RailSpline->GetSplineLength();
+    const int32 NumSamples = FMath::Max(2, FMath::CeilToInt(SplineLength / FMath::Max<float>(RailSampleSpacing, 1)) + 1);
+
+    FVector BottomForward = LadderForwardDir;
+    FVector TopForward = LadderForwardDir;
+
+    for (int32 Index = 0; Index < NumSamples; ++Index)
+    {
+        const float Distance = SplineLength * Index / (NumSamples - 1);
+        const FVector Point = RailSpline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+        const FVector Tangent = RailSpline->GetDirectionAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+
+        FVector Forward = FVector::VectorPlaneProject(LadderForwardDir, Tangent).GetSafeNormal();
+        if (Forward.IsNearlyZero())
+        {
+            Forward = LadderForwardDir;
+        }
+
+        AddRailSample(Point, Forward);
+
+        if (Index == 0)
+        {
+            BottomForward = Forward;
+        }
+        TopForward = Forward;
+    }
+
+    Rail.Length = SplineLength;
+
+    const FVector BottomPointLoc = RailSpline->GetLocationAtDistanceAlongSpline(0, ESplineCoordinateSpace::World);
+    const FVector TopPointLoc = RailSpline->GetLocationAtDistanceAlongSpline(SplineLength, ESplineCoordinateSpace::World);
+
+    Rail.TopExitLocation = TopPointLoc + TopForward.GetSafeNormal2D() * ExitForwardDistance;
+    Rail.BottomExitLocation = BottomPointLoc + BottomForward.GetSafeNormal2D() * BottomExitForwardDistance;
+}
+
+void ASoulLadderActor::AddRailSample(const FVector& LadderPoint, const FVector& Forward)
+{
+    const FVector FaceDir = -Forward;
+
+    Rail.SnapLocations.Add(LadderPoint + FaceDir * SnapDistanceFromLadder);
+    Rail.Facings.Add(FRotator(0, FaceDir.Rotation().Yaw, 0));
+}
+
+void FSoulLadderRail::Sample(float Distance, FVector& OutLocation, FRotator& OutFacing) const
+{
+    const float Position = FMath::Clamp<float>(Distance, 0, Length) / FMath::Max<float>(SampleSpacing, KINDA_SMALL_NUMBER);
+    const int32 Index = FMath::Clamp(FMath::FloorToInt(Position), 0, SnapLocations.Num() - 2);
+    const float Alpha = FMath::Clamp<float>(Position - Index, 0, 1);
+
+    OutLocation = FMath::Lerp(SnapLocations[Index], SnapLocations[Index + 1], Alpha);
+    OutFacing = FQuat::Slerp(Facings[Index].Quaternion(), Facings[Index + 1].Quaternion(), Alpha).Rotator();
+}
+
+float FSoulLadderRail::FindNearestDistance(const FVector& Location) const
+{
+    float BestDistance = 0;
+    float BestDistSq = TNumericLimits<float>::Max();
+
+    for (int32 Index = 0; Index < SnapLocations.Num() - 1; ++Index)
+    {
+        const FVector Closest = FMath::ClosestPointOnSegment(Location, SnapLocations[Index], SnapLocations[Index + 1]);
+        const float DistSq = FVector::DistSquared(Location, Closest);
+        if (DistSq < BestDistSq)
+        {
+            const float SegmentLength = FVector::Dist(SnapLocations[Index], SnapLocations[Index + 1]);
+            const float SegmentAlpha = SegmentLength > KINDA_SMALL_NUMBER ? FVector::Dist(SnapLocations[Index], Closest) / SegmentLength : 0;
+
+            BestDistSq = DistSq;
+            BestDistance = (Index + SegmentAlpha) * SampleSpacing;
+        }
+    }
+
+    return FMath::Clamp<float>(BestDistance, 0, Length);
 }
 
 void ASoulLadderActor::Interact_Implementation(ASoulCharacter* Interactor)
@@ -130,58 +259,7 @@ void ASoulLadderActor::OnTopEndOverlap(UPrimitiveComponent*, AActor* OtherActor,
     }
 }
 
-void ASoulLadderActor::GetClimbZRange(float& OutMinZ, float& OutMaxZ) const
-{
-    const float BottomZ = BottomPoint ? BottomPoint->GetComponentLocation().Z : GetActorLocation().Z;
-    const float TopZ = TopPoint ? TopPoint->GetComponentLocation().Z : GetActorLocation().Z + 300;
-
-    OutMinZ = FMath::Min(BottomZ, TopZ);
-    OutMaxZ = FMath::Max(BottomZ, TopZ);
-}
-
-void ASoulLadderActor::GetSnapTransform(const ASoulCharacter* Character, FVector& OutLoc, FRotator& OutRot) const
-{
-    const FVector Forward = LadderForward ? LadderForward->GetForwardVector() : GetActorForwardVector();
-
-    const FVector FaceDir = -Forward;
-    OutRot = FaceDir.Rotation();
-
-    FVector Desired = GetActorLocation() + FaceDir * SnapDistanceFromLadder;
-
-    float MinZ, MaxZ;
-    GetClimbZRange(MinZ, MaxZ);
-
-    float Z = Character ? Character->GetActorLocation().Z : Desired.Z;
-    Z = FMath::Clamp(Z, MinZ, MaxZ);
-    Desired.Z = Z;
-
-    OutLoc = Desired;
-}
-
 FVector ASoulLadderActor::GetForward() const
 {
     return LadderForward ? LadderForward->GetForwardVector() : GetActorForwardVector();
-}
-
-FVector ASoulLadderActor::GetTopExitLocation() const
-{
-    const FVector Forward = GetForward();
-    return TopPoint->GetComponentLocation() + Forward * ExitForwardDistance;
-}
-
-FVector ASoulLadderActor::GetBottomExitLocation() const
-{
-    const FVector Forward = GetForward();
-    return BottomPoint->GetComponentLocation() + Forward * BottomExitForwardDistance;
-}
-
-FVector ASoulLadderActor::GetTopMountStartLocation() const
-{
-    return TopMountStartPoint ? TopMountStartPoint->GetComponentLocation() : GetActorLocation();
-}
-
-FRotator ASoulLadderActor::GetTopMountStartRotation() const
-{
-    const FVector Forward = -GetForward();
-    return (-Forward).Rotation();
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 class UBoxComponent;
 class UArrowComponent;
+class USplineComponent;
 
 UENUM(BlueprintType)
 enum class ELadderUseSide : uint8
@@ -16,6 +17,24 @@ enum class ELadderUseSide : uint8
 	Top		UMETA(DisplayName = "Top")
 };
 
+struct FSoulLadderRail
+{
+	TArray<FVector> SnapLocations;
+	TArray<FRotator> Facings;
+	float Length = 0;
+	float SampleSpacing = 0;
+
+	FVector TopExitLocation = FVector::ZeroVector;
+	FVector BottomExitLocation = FVector::ZeroVector;
+	FVector TopMountStartLocation = FVector::ZeroVector;
+	FRotator TopMountStartRotation = FRotator::ZeroRotator;
+
+	FORCEINLINE bool IsValid() const { return SnapLocations.Num() >= 2; }
+
+	void Sample(float Distance, FVector& OutLocation, FRotator& OutFacing) const;
+	float FindNearestDistance(const FVector& Location) const;
+};
+
 UCLASS()
 class SOUL_API ASoulLadderActor : public AActor, public ISoulInteractableInterface
 {
@@ -25,19 +44,17 @@ public:
 	ASoulLadderActor();
 
 	FORCEINLINE ELadderUseSide GetLastUseSide() const { return LastUseSide; }
+	FORCEINLINE const FSoulLadderRail& GetRail() const { return Rail; }
 
 	virtual void Interact_Implementation(ASoulCharacter* Interactor) override;
 	virtual bool CanInteract_Implementation(ASoulCharacter* Interactor) const override;
 	virtual FText GetInteractText_Implementation() const override;
 
-	void GetClimbZRange(float& OutMinZ, float& OutMaxZ) const;
-	void GetSnapTransform(const ASoulCharacter* Character, FVector& OutLoc, FRotator& OutRot) const;
+	FORCEINLINE FVector GetTopExitLocation() const { return Rail.TopExitLocation; }
+	FORCEINLINE FVector GetBottomExitLocation() const { return Rail.BottomExitLocation; }
 
-	FVector GetTopExitLocation() const;
-	FVector GetBottomExitLocation() const;
-
-	FVector GetTopMountStartLocation() const;
-	FRotator GetTopMountStartRotation() const;
+	FORCEINLINE FVector GetTopMountStartLocation() const { return Rail.TopMountStartLocation; }
+	FORCEINLINE FRotator GetTopMountStartRotation() const { return Rail.TopMountStartRotation; }
 
 protected:
 	virtual void BeginPlay() override;
@@ -55,7 +72,13 @@ protected:
 	void OnTopEndOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
 
 	FVector GetForward() const;
-	
+
+	void BakeRail();
+	void BakeStraightRail();
+	void BakeSplineRail();
+	void AddRailSample(const FVector& LadderPoint, const FVector& Forward);
+
+	void OnRootTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
 
 protected:
 	UPROPERTY(VisibleAnywhere)
@@ -82,6 +105,15 @@ protected:
 	UPROPERTY(VisibleAnywhere)
 	TObjectPtr<USceneComponent> TopMountStartPoint;
 
+	UPROPERTY(VisibleAnywhere)
+	TObjectPtr<USplineComponent> RailSpline;
+
+	UPROPERTY(EditAnywhere, Category = "Ladder")
+	bool bUseRailSpline = false;
+
+	UPROPERTY(EditAnywhere, Category = "Ladder", meta = (EditCondition = "bUseRailSpline", ClampMin = "1"))
+	float RailSampleSpacing = 10;
+
 	UPROPERTY(EditAnywhere, Category = "Ladder")
 	float SnapDistanceFromLadder = -40;
 
@@ -93,4 +125,6 @@ protected:
 
 	UPROPERTY(EditAnywhere, Category = "Ladder")
 	float BottomExitForwardDistance = 40;
+
+	FSoulLadderRail Rail;
 };
\ No newline at end of file
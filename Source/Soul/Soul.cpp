@@ -1,6 +1,21 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Soul.h"
+#include "Common/SoulCombatTelemetry.h"
 #include "Modules/ModuleManager.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, Soul, "Soul" );
+class FSoulGameModule : public FDefaultGameModuleImpl
+{
+public:
+	virtual void StartupModule() override
+	{
+		FSoulCombatTelemetry::Get().StartWriter();
+	}
+
+	virtual void ShutdownModule() override
+	{
+		FSoulCombatTelemetry::Get().StopWriter();
+	}
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FSoulGameModule, Soul, "Soul" );
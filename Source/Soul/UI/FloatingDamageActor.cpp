@@ -1,4 +1,5 @@
 #include "FloatingDamageActor.h"
+#include "SoulDamageTextPoolSubsystem.h"
 
 #include "Components/WidgetComponent.h"
 #include "Blueprint/UserWidget.h"
@@ -23,18 +24,61 @@ AFloatingDamageActor::AFloatingDamageActor()
 void AFloatingDamageActor::BeginPlay()
 {
     Super::BeginPlay();
-    SetLifeSpan(LifeTime);
+    ActivatedTime = GetWorld()->GetTimeSeconds();
 }
 
 void AFloatingDamageActor::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
 
+    Age += DeltaTime;
+    if (Age >= LifeTime)
+    {
+        if (USoulDamageTextPoolSubsystem* Pool = OwningPool.Get())
+        {
+            Pool->Release(this);
+        }
+        else
+        {
+            Destroy();
+        }
+        return;
+    }
+
     FVector NewLocation = GetActorLocation();
     NewLocation.Z += RiseSpeed * DeltaTime;
     SetActorLocation(NewLocation);
 }
 
+void AFloatingDamageActor::ActivateDamageText(const FVector& Location, float Damage)
+{
+    Age = 0;
+    ActivatedTime = GetWorld()->GetTimeSeconds();
+    bDamageTextActive = true;
+
+    SetActorLocation(Location);
+    SetDamage(Damage);
+
+    WidgetComponent->SetVisibility(true);
+    SetActorHiddenInGame(false);
+    SetActorTickEnabled(true);
+}
+
+void AFloatingDamageActor::DeactivateDamageText()
+{
+    bDamageTextActive = false;
+
+    SetActorTickEnabled(false);
+    SetActorHiddenInGame(true);
+    WidgetComponent->SetVisibility(false);
+}
+
+void AFloatingDamageActor::SetOwningPool(USoulDamageTextPoolSubsystem* Pool, int32 Index)
+{
+    OwningPool = Pool;
+    PoolIndex = Index;
+}
+
 void AFloatingDamageActor::SetDamage(float Damage)
 {
     if (UUserWidget* Widget = WidgetComponent->GetWidget())
@@ -4,6 +4,8 @@
 #include "GameFramework/Actor.h"
 #include "FloatingDamageActor.generated.h"
 
+class USoulDamageTextPoolSubsystem;
+
 UCLASS()
 class SOUL_API AFloatingDamageActor : public AActor
 {
@@ -14,6 +16,15 @@ public:
 
     void SetDamage(float Damage);
 
+    void ActivateDamageText(const FVector& Location, float Damage);
+    void DeactivateDamageText();
+
+    FORCEINLINE bool IsDamageTextActive() const { return bDamageTextActive; }
+    FORCEINLINE float GetActivatedTime() const { return ActivatedTime; }
+
+    void SetOwningPool(USoulDamageTextPoolSubsystem* Pool, int32 Index);
+    FORCEINLINE int32 GetPoolIndex() const { return PoolIndex; }
+
 protected:
     virtual void BeginPlay() override;
     virtual void Tick(float DeltaTime) override;
@@ -26,4 +37,11 @@ private:
 
     UPROPERTY(EditDefaultsOnly, Category = "Damage")
     float RiseSpeed = 50;
+
+    float Age = 0;
+    float ActivatedTime = 0;
+    bool bDamageTextActive = true;
+
+    TWeakObjectPtr<USoulDamageTextPoolSubsystem> OwningPool;
+    int32 PoolIndex = INDEX_NONE;
 };
\ No newline at end of file
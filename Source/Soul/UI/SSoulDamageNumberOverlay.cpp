@@ -0,0 +1,75 @@
+#include "SSoulDamageNumberOverlay.h"
+#include "SoulDamageNumberSubsystem.h"
+
+#include "GameFramework/PlayerController.h"
+#include "Styling/CoreStyle.h"
+#include "Rendering/DrawElements.h"
+
+void SSoulDamageNumberOverlay::Construct(const FArguments& InArgs)
+{
+	OwningPlayer = InArgs._OwningPlayer;
+	DamageNumbers = InArgs._DamageNumbers;
+	Font = FCoreStyle::GetDefaultFontStyle("Bold", InArgs._FontSize);
+
+	SetVisibility(EVisibility::HitTestInvisible);
+	SetCanTick(false);
+	ForceVolatile(true);
+}
+
+FVector2D SSoulDamageNumberOverlay::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	return FVector2D::ZeroVector;
+}
+
+int32 SSoulDamageNumberOverlay::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	const APlayerController* PC = OwningPlayer.Get();
+	const USoulDamageNumberSubsystem* Numbers = DamageNumbers.Get();
+
+	if (!PC || !Numbers || Numbers->Num() == 0)
+	{
+		return LayerId;
+	}
+
+	const TArray<FVector>& WorldPositions = Numbers->GetWorldPositions();
+	const TArray<int32>& Damages = Numbers->GetDamages();
+	const TArray<float>& Ages = Numbers->GetAges();
+	const TArray<FLinearColor>& Colors = Numbers->GetColors();
+
+	const float InvScale = 1 / FMath::Max(AllottedGeometry.Scale, KINDA_SMALL_NUMBER);
+	const float LifeTime = FMath::Max(Numbers->GetLifeTime(), KINDA_SMALL_NUMBER);
+	const float RiseSpeed = Numbers->GetRiseSpeed();
+	const FVector2f LabelSize(Font.Size * 4, Font.Size * 1.5);
+
+	for (int32 Index = 0; Index < WorldPositions.Num(); ++Index)
+	{
+		const FVector WorldPosition = WorldPositions[Index] + FVector(0, 0, RiseSpeed * Ages[Index]);
+
+		FVector2D ScreenPosition;
+		if (!PC->ProjectWorldLocationToScreen(WorldPosition, ScreenPosition, true))
+		{
+			continue;
+		}
+
+		const FVector2f LocalPosition = FVector2f(ScreenPosition * InvScale) - LabelSize * 0.5;
+
+		FLinearColor Color = Colors[Index] * InWidgetStyle.GetColorAndOpacityTint();
+		Color.A *= 1 - Ages[Index] / LifeTime;
+
+		TCHAR Label[16];
+		const int32 LabelLength = FCString::Snprintf(Label, UE_ARRAY_COUNT(Label), TEXT("%d"), Damages[Index]);
+
+		FSlateDrawElement::MakeText(
+			OutDrawElements,
+			LayerId,
+			AllottedGeometry.ToPaintGeometry(LabelSize, FSlateLayoutTransform(LocalPosition)),
+			Label,
+			0,
+			LabelLength,
+			Font,
+			ESlateDrawEffect::None,
+			Color);
+	}
+
+	return LayerId + 1;
+}
\ No newline at end of file
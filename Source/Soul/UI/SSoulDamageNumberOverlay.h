@@ -0,0 +1,32 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+#include "Fonts/SlateFontInfo.h"
+
+class APlayerController;
+class USoulDamageNumberSubsystem;
+
+class SOUL_API SSoulDamageNumberOverlay : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SSoulDamageNumberOverlay)
+		: _FontSize(20)
+	{}
+		SLATE_ARGUMENT(TWeakObjectPtr<APlayerController>, OwningPlayer)
+		SLATE_ARGUMENT(TWeakObjectPtr<USoulDamageNumberSubsystem>, DamageNumbers)
+		SLATE_ARGUMENT(int32, FontSize)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+protected:
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+private:
+	TWeakObjectPtr<APlayerController> OwningPlayer;
+	TWeakObjectPtr<USoulDamageNumberSubsystem> DamageNumbers;
+	FSlateFontInfo Font;
+};
\ No newline at end of file
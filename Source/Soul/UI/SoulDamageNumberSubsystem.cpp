@@ -0,0 +1,60 @@
+#include "SoulDamageNumberSubsystem.h"
+
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarSoulBatchedDamageNumbers(
+	TEXT("soul.UI.BatchedDamageNumbers"),
+	false,
+	TEXT("If true, damage numbers are drawn by a single viewport overlay instead of pooled AFloatingDamageActor instances."),
+	ECVF_Default);
+
+bool USoulDamageNumberSubsystem::IsBatchedRenderingEnabled()
+{
+	return CVarSoulBatchedDamageNumbers.GetValueOnGameThread();
+}
+
+bool USoulDamageNumberSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USoulDamageNumberSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USoulDamageNumberSubsystem, STATGROUP_Tickables);
+}
+
+void USoulDamageNumberSubsystem::AddDamageNumber(const FVector& WorldPosition, float Damage, const FLinearColor& Color)
+{
+	if (WorldPositions.Num() >= MaxDamageNumbers)
+	{
+		return;
+	}
+
+	WorldPositions.Add(WorldPosition);
+	Damages.Add(FMath::RoundToInt(Damage));
+	Ages.Add(0);
+	Colors.Add(Color);
+}
+
+void USoulDamageNumberSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	for (int32 Index = Ages.Num() - 1; Index >= 0; --Index)
+	{
+		Ages[Index] += DeltaTime;
+
+		if (Ages[Index] >= LifeTime)
+		{
+			RemoveAtSwap(Index);
+		}
+	}
+}
+
+void USoulDamageNumberSubsystem::RemoveAtSwap(int32 Index)
+{
+	WorldPositions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Damages.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Ages.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Colors.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SoulDamageNumberSubsystem.generated.h"
+
+UCLASS()
+class SOUL_API USoulDamageNumberSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static bool IsBatchedRenderingEnabled();
+
+	void AddDamageNumber(const FVector& WorldPosition, float Damage, const FLinearColor& Color = FLinearColor::White);
+
+	FORCEINLINE int32 Num() const { return WorldPositions.Num(); }
+	FORCEINLINE const TArray<FVector>& GetWorldPositions() const { return WorldPositions; }
+	FORCEINLINE const TArray<int32>& GetDamages() const { return Damages; }
+	FORCEINLINE const TArray<float>& GetAges() const { return Ages; }
+	FORCEINLINE const TArray<FLinearColor>& GetColors() const { return Colors; }
+
+	FORCEINLINE float GetLifeTime() const { return LifeTime; }
+	FORCEINLINE float GetRiseSpeed() const { return RiseSpeed; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	void RemoveAtSwap(int32 Index);
+
+protected:
+	TArray<FVector> WorldPositions;
+	TArray<int32> Damages;
+	TArray<float> Ages;
+	TArray<FLinearColor> Colors;
+
+	float LifeTime = 1.2;
+	float RiseSpeed = 50;
+
+	static constexpr int32 MaxDamageNumbers = 512;
+};
\ No newline at end of file
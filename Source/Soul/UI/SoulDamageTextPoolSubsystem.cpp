@@ -0,0 +1,120 @@
+#include "SoulDamageTextPoolSubsystem.h"
+#include "FloatingDamageActor.h"
+#include "../Common/SoulStats.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Damage Text Pool Hits"), STAT_SoulDamageTextPoolHits, STATGROUP_Soul);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Damage Text Pool Misses"), STAT_SoulDamageTextPoolMisses, STATGROUP_Soul);
+
+bool USoulDamageTextPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USoulDamageTextPoolSubsystem::Prewarm(TSubclassOf<AFloatingDamageActor> ActorClass)
+{
+	if (!ActorClass)
+	{
+		return;
+	}
+
+	FindOrCreatePool(ActorClass);
+}
+
+FSoulDamageTextPool& USoulDamageTextPoolSubsystem::FindOrCreatePool(TSubclassOf<AFloatingDamageActor> ActorClass)
+{
+	if (FSoulDamageTextPool* Found = Pools.Find(ActorClass.Get()))
+	{
+		return *Found;
+	}
+
+	FSoulDamageTextPool& Pool = Pools.Add(ActorClass.Get());
+
+	const int32 NumToSpawn = FMath::Max(1, PoolSize);
+	Pool.Actors.Reserve(NumToSpawn);
+	Pool.FreeIndices.Reserve(NumToSpawn);
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	for (int32 Index = 0; Index < NumToSpawn; ++Index)
+	{
+		AFloatingDamageActor* Actor = GetWorld()->SpawnActor<AFloatingDamageActor>(ActorClass, FVector::ZeroVector, FRotator::ZeroRotator, Params);
+		if (!Actor)
+		{
+			continue;
+		}
+
+		const int32 PoolIndex = Pool.Actors.Add(Actor);
+		Actor->SetOwningPool(this, PoolIndex);
+		Actor->DeactivateDamageText();
+		Pool.FreeIndices.Add(PoolIndex);
+	}
+
+	return Pool;
+}
+
+AFloatingDamageActor* USoulDamageTextPoolSubsystem::ShowDamage(TSubclassOf<AFloatingDamageActor> ActorClass, const FVector& Location, float Damage)
+{
+	if (!ActorClass)
+	{
+		return nullptr;
+	}
+
+	FSoulDamageTextPool& Pool = FindOrCreatePool(ActorClass);
+
+	int32 Index = INDEX_NONE;
+	if (Pool.FreeIndices.Num() > 0)
+	{
+		Index = Pool.FreeIndices.Pop(EAllowShrinking::No);
+		++PoolHits;
+		INC_DWORD_STAT(STAT_SoulDamageTextPoolHits);
+	}
+	else
+	{
+		Index = FindOldestActive(Pool);
+		++PoolMisses;
+		INC_DWORD_STAT(STAT_SoulDamageTextPoolMisses);
+	}
+
+	if (!Pool.Actors.IsValidIndex(Index) || !Pool.Actors[Index])
+	{
+		return nullptr;
+	}
+
+	AFloatingDamageActor* Actor = Pool.Actors[Index];
+	Actor->ActivateDamageText(Location, Damage);
+	return Actor;
+}
+
+void USoulDamageTextPoolSubsystem::Release(AFloatingDamageActor* Actor)
+{
+	if (!Actor || !Actor->IsDamageTextActive())
+	{
+		return;
+	}
+
+	Actor->DeactivateDamageText();
+
+	if (FSoulDamageTextPool* Pool = Pools.Find(Actor->GetClass()))
+	{
+		Pool->FreeIndices.Add(Actor->GetPoolIndex());
+	}
+}
+
+int32 USoulDamageTextPoolSubsystem::FindOldestActive(const FSoulDamageTextPool& Pool) const
+{
+	int32 OldestIndex = INDEX_NONE;
+	float OldestTime = TNumericLimits<float>::Max();
+
+	for (int32 Index = 0; Index < Pool.Actors.Num(); ++Index)
+	{
+		const AFloatingDamageActor* Actor = Pool.Actors[Index];
+		if (Actor && Actor->GetActivatedTime() < OldestTime)
+		{
+			OldestTime = Actor->GetActivatedTime();
+			OldestIndex = Index;
+		}
+	}
+
+	return OldestIndex;
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SoulDamageTextPoolSubsystem.generated.h"
+
+class AFloatingDamageActor;
+
+USTRUCT()
+struct FSoulDamageTextPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AFloatingDamageActor>> Actors;
+
+	TArray<int32> FreeIndices;
+};
+
+UCLASS(Config = Game)
+class SOUL_API USoulDamageTextPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void Prewarm(TSubclassOf<AFloatingDamageActor> ActorClass);
+
+	AFloatingDamageActor* ShowDamage(TSubclassOf<AFloatingDamageActor> ActorClass, const FVector& Location, float Damage);
+
+	void Release(AFloatingDamageActor* Actor);
+
+	FORCEINLINE int32 GetPoolHits() const { return PoolHits; }
+	FORCEINLINE int32 GetPoolMisses() const { return PoolMisses; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	FSoulDamageTextPool& FindOrCreatePool(TSubclassOf<AFloatingDamageActor> ActorClass);
+	int32 FindOldestActive(const FSoulDamageTextPool& Pool) const;
+
+protected:
+	UPROPERTY(Config)
+	int32 PoolSize = 32;
+
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FSoulDamageTextPool> Pools;
+
+	int32 PoolHits = 0;
+	int32 PoolMisses = 0;
+};
\ No newline at end of file